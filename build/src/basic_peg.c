@@ -0,0 +1,10421 @@
+
+/* Generated by leg.py */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifndef YY_LOCAL
+#define YY_LOCAL(T) static T
+#endif
+#ifndef YY_ACTION
+#define YY_ACTION(T) static T
+#endif
+#ifndef YY_RULE
+#define YY_RULE(T) static T
+#endif
+#ifndef YY_PARSE
+#define YY_PARSE(T) T
+#endif
+#ifndef YYSTYPE
+#define YYSTYPE int
+#endif
+#ifndef YY_INPUT
+#define YY_INPUT(buf, result, max_size) \
+  { int yyc = getc(stdin); result = (EOF == yyc) ? 0 : (*(buf) = yyc, 1); }
+#endif
+
+typedef struct _yycontext yycontext;
+typedef void (*yyaction)(yycontext *yy, char *yytext, int yyleng);
+typedef struct _yythunk { int begin, end; yyaction action; } yythunk;
+
+struct _yycontext {
+  char *__buf; int __buflen; int __pos; int __limit;
+  char *__text; int __textlen; int __begin; int __end; int __textmax;
+  yythunk *__thunks; int __thunkslen; int __thunkpos;
+  YYSTYPE __; YYSTYPE *__val; YYSTYPE *__vals; int __valslen;
+};
+
+static yycontext _yyctx;
+static yycontext *yyctx = &_yyctx;
+
+YY_LOCAL(int) yyrefill(yycontext *yy)
+{
+  int yyn;
+  while (yy->__buflen - yy->__pos < 512)
+  {
+    yy->__buflen *= 2;
+    yy->__buf = (char *)realloc(yy->__buf, yy->__buflen);
+  }
+  YY_INPUT((yy->__buf + yy->__pos), yyn, (yy->__buflen - yy->__pos));
+  if (!yyn) return 0;
+  yy->__limit += yyn;
+  return 1;
+}
+
+static int yymatchDot(yycontext *yy)
+{
+  if (yy->__pos >= yy->__limit && !yyrefill(yy)) return 0;
+  ++yy->__pos;
+  return 1;
+}
+
+static int yymatchChar(yycontext *yy, int c)
+{
+  if (yy->__pos >= yy->__limit && !yyrefill(yy)) return 0;
+  if ((unsigned char)yy->__buf[yy->__pos] == c)
+  {
+    ++yy->__pos;
+    return 1;
+  }
+  return 0;
+}
+
+static int yymatchString(yycontext *yy, const char *s)
+{
+  int yysav = yy->__pos;
+  while (*s)
+  {
+    if (yy->__pos >= yy->__limit && !yyrefill(yy)) return 0;
+    if (yy->__buf[yy->__pos] != *s)
+    {
+      yy->__pos = yysav;
+      return 0;
+    }
+    ++s;
+    ++yy->__pos;
+  }
+  return 1;
+}
+
+static int yymatchClass(yycontext *yy, unsigned char *bits)
+{
+  int c;
+  if (yy->__pos >= yy->__limit && !yyrefill(yy)) return 0;
+  c = (unsigned char)yy->__buf[yy->__pos];
+  if (bits[c >> 3] & (1 << (c & 7)))
+  {
+    ++yy->__pos;
+    return 1;
+  }
+  return 0;
+}
+
+static void yyDo(yycontext *yy, yyaction action, int begin, int end)
+{
+  while (yy->__thunkpos >= yy->__thunkslen)
+  {
+    yy->__thunkslen *= 2;
+    yy->__thunks = (yythunk *)realloc(yy->__thunks, sizeof(yythunk) * yy->__thunkslen);
+  }
+  yy->__thunks[yy->__thunkpos].begin = begin;
+  yy->__thunks[yy->__thunkpos].end = end;
+  yy->__thunks[yy->__thunkpos].action = action;
+  ++yy->__thunkpos;
+}
+
+static int yyText(yycontext *yy, int begin, int end)
+{
+  int yyleng = end - begin;
+  if (yyleng <= 0)
+    yyleng = 0;
+  else
+  {
+    while (yy->__textlen < (yyleng + 1))
+    {
+      yy->__textlen *= 2;
+      yy->__text = (char *)realloc(yy->__text, yy->__textlen);
+    }
+    memcpy(yy->__text, yy->__buf + begin, yyleng);
+  }
+  yy->__text[yyleng] = '\0';
+  return yyleng;
+}
+
+static void yyDone(yycontext *yy)
+{
+  int pos;
+  for (pos = 0; pos < yy->__thunkpos; ++pos)
+  {
+    yythunk *thunk = &yy->__thunks[pos];
+    int yyleng = thunk->end ? yyText(yy, thunk->begin, thunk->end) : thunk->begin;
+    thunk->action(yy, yy->__text, yyleng);
+  }
+  yy->__thunkpos = 0;
+}
+
+static void yyCommit(yycontext *yy)
+{
+  if ((yy->__limit -= yy->__pos))
+    memmove(yy->__buf, yy->__buf + yy->__pos, yy->__limit);
+  yy->__begin -= yy->__pos;
+  yy->__end -= yy->__pos;
+  yy->__pos = yy->__thunkpos = 0;
+}
+
+static void yyPush(yycontext *yy, char *text, int count)
+{
+  (void)text;
+  yy->__val += count;
+  while (yy->__valslen <= yy->__val - yy->__vals)
+  {
+    long offset = yy->__val - yy->__vals;
+    yy->__valslen *= 2;
+    yy->__vals = (YYSTYPE *)realloc(yy->__vals, sizeof(YYSTYPE) * yy->__valslen);
+    yy->__val = yy->__vals + offset;
+  }
+}
+static void yyPop(yycontext *yy, char *text, int count) { (void)text; yy->__val -= count; }
+static void yySet(yycontext *yy, char *text, int count) { (void)text; yy->__val[count] = yy->__; }
+
+YY_RULE(int) yy_Program(yycontext *yy);
+YY_RULE(int) yy_ProgramLine(yycontext *yy);
+YY_RULE(int) yy_StatementLine(yycontext *yy);
+YY_RULE(int) yy_Statement(yycontext *yy);
+YY_RULE(int) yy_ERROR(yycontext *yy);
+YY_RULE(int) yy_ERROREXP(yycontext *yy);
+YY_RULE(int) yy_IONumExpr2(yycontext *yy);
+YY_RULE(int) yy_LetExpr(yycontext *yy);
+YY_RULE(int) yy_LetExprStr(yycontext *yy);
+YY_RULE(int) yy_LetExprNum(yycontext *yy);
+YY_RULE(int) yy_NumExpr2(yycontext *yy);
+YY_RULE(int) yy_NumExpr3(yycontext *yy);
+YY_RULE(int) yy_NumExpr4(yycontext *yy);
+YY_RULE(int) yy_CircleExpr(yycontext *yy);
+YY_RULE(int) yy_IOChan(yycontext *yy);
+YY_RULE(int) yy_IOChanErr(yycontext *yy);
+YY_RULE(int) yy_AnyExpr(yycontext *yy);
+YY_RULE(int) yy_VarNumComma(yycontext *yy);
+YY_RULE(int) yy_NumComma(yycontext *yy);
+YY_RULE(int) yy_LabelComma(yycontext *yy);
+YY_RULE(int) yy_PrintExpr(yycontext *yy);
+YY_RULE(int) yy_FlagExpr(yycontext *yy);
+YY_RULE(int) yy_ForStmtExpr(yycontext *yy);
+YY_RULE(int) yy_GetExpr(yycontext *yy);
+YY_RULE(int) yy_PutExpr(yycontext *yy);
+YY_RULE(int) yy_XioExpr(yycontext *yy);
+YY_RULE(int) yy_StatusExpr(yycontext *yy);
+YY_RULE(int) yy_PrintIoExpr(yycontext *yy);
+YY_RULE(int) yy_InputExpr(yycontext *yy);
+YY_RULE(int) yy_IfNumberExpr(yycontext *yy);
+YY_RULE(int) yy_IfThenExpr(yycontext *yy);
+YY_RULE(int) yy_ListExpr(yycontext *yy);
+YY_RULE(int) yy_LocateExpr(yycontext *yy);
+YY_RULE(int) yy_IOVarNumExpr2(yycontext *yy);
+YY_RULE(int) yy_OpenExpr(yycontext *yy);
+YY_RULE(int) yy_OnExpr(yycontext *yy);
+YY_RULE(int) yy_LabelOrLNumExpr(yycontext *yy);
+YY_RULE(int) yy_TextExpr(yycontext *yy);
+YY_RULE(int) yy_ProcVar(yycontext *yy);
+YY_RULE(int) yy_ProcVariableList(yycontext *yy);
+YY_RULE(int) yy_ProcVarList(yycontext *yy);
+YY_RULE(int) yy_LabelProcVarList(yycontext *yy);
+YY_RULE(int) yy_ExecParExpr(yycontext *yy);
+YY_RULE(int) yy_AnyExprList(yycontext *yy);
+YY_RULE(int) yy_LabelExecParList(yycontext *yy);
+YY_RULE(int) yy_VariableList(yycontext *yy);
+YY_RULE(int) yy_PVarNumStr(yycontext *yy);
+YY_RULE(int) yy_AssignVarNum(yycontext *yy);
+YY_RULE(int) yy_AssignVarStr(yycontext *yy);
+YY_RULE(int) yy_ArrayAccess(yycontext *yy);
+YY_RULE(int) yy_DimVarList(yycontext *yy);
+YY_RULE(int) yy_DimVar(yycontext *yy);
+YY_RULE(int) yy_Label(yycontext *yy);
+YY_RULE(int) yy_PVarStr(yycontext *yy);
+YY_RULE(int) yy_PVarNum(yycontext *yy);
+YY_RULE(int) yy_PVarArray(yycontext *yy);
+YY_RULE(int) yy_PDimVarArray(yycontext *yy);
+YY_RULE(int) yy_PDimVarStr(yycontext *yy);
+YY_RULE(int) yy_StringDef(yycontext *yy);
+YY_RULE(int) yy_NumericDef(yycontext *yy);
+YY_RULE(int) yy_NumExprErr(yycontext *yy);
+YY_RULE(int) yy_StrExprErr(yycontext *yy);
+YY_RULE(int) yy_StrExpr(yycontext *yy);
+YY_RULE(int) yy_StringData(yycontext *yy);
+YY_RULE(int) yy_ConstString(yycontext *yy);
+YY_RULE(int) yy_StrContent(yycontext *yy);
+YY_RULE(int) yy_ExtStringStart(yycontext *yy);
+YY_RULE(int) yy_ExtStringEnd(yycontext *yy);
+YY_RULE(int) yy_ExtendedString(yycontext *yy);
+YY_RULE(int) yy_NumExpr(yycontext *yy);
+YY_RULE(int) yy_AndExpr(yycontext *yy);
+YY_RULE(int) yy_NotExpr(yycontext *yy);
+YY_RULE(int) yy_CompExpr(yycontext *yy);
+YY_RULE(int) yy_CompRight(yycontext *yy);
+YY_RULE(int) yy_AddExpr(yycontext *yy);
+YY_RULE(int) yy_MultExpr(yycontext *yy);
+YY_RULE(int) yy_BitExpr(yycontext *yy);
+YY_RULE(int) yy_PowExpr(yycontext *yy);
+YY_RULE(int) yy_NegExpr(yycontext *yy);
+YY_RULE(int) yy_UnitExpr(yycontext *yy);
+YY_RULE(int) yy_ConstNum(yycontext *yy);
+YY_RULE(int) yy_StrCompExpr(yycontext *yy);
+YY_RULE(int) yy_NumAComma(yycontext *yy);
+YY_RULE(int) yy_ParUsrExpr(yycontext *yy);
+YY_RULE(int) yy_ParNumExpr(yycontext *yy);
+YY_RULE(int) yy_ParInstrExpr(yycontext *yy);
+YY_RULE(int) yy_ParStrExpr(yycontext *yy);
+YY_RULE(int) yy_SPC(yycontext *yy);
+YY_RULE(int) yy_EndOfLine(yycontext *yy);
+YY_RULE(int) yy_NotEOL(yycontext *yy);
+YY_RULE(int) yy_EndOfFile(yycontext *yy);
+YY_RULE(int) yy_UnicodeBOM(yycontext *yy);
+YY_RULE(int) yy_LineNumber(yycontext *yy);
+YY_RULE(int) yy_IdentifierInit(yycontext *yy);
+YY_RULE(int) yy_IdentifierChar(yycontext *yy);
+YY_RULE(int) yy_Identifier(yycontext *yy);
+YY_RULE(int) yy_Number(yycontext *yy);
+YY_RULE(int) yy_HexNumber(yycontext *yy);
+YY_RULE(int) yy_IntNumber(yycontext *yy);
+YY_RULE(int) yy_DecNumber(yycontext *yy);
+YY_RULE(int) yy_NumExp(yycontext *yy);
+YY_RULE(int) yy_RemExpr1(yycontext *yy);
+YY_RULE(int) yy_RemExpr2(yycontext *yy);
+YY_RULE(int) yy_RemExpr3(yycontext *yy);
+YY_RULE(int) yy_RemStmt1(yycontext *yy);
+YY_RULE(int) yy_RemStmt2(yycontext *yy);
+YY_RULE(int) yy_RemStmt3(yycontext *yy);
+YY_RULE(int) yy_REM_C(yycontext *yy);
+YY_RULE(int) yy_COMMA(yycontext *yy);
+YY_RULE(int) yy_SEMICOLON(yycontext *yy);
+YY_RULE(int) yy_SHARP(yycontext *yy);
+YY_RULE(int) yy_LEQ(yycontext *yy);
+YY_RULE(int) yy_NEQ(yycontext *yy);
+YY_RULE(int) yy_GEQ(yycontext *yy);
+YY_RULE(int) yy_LE(yycontext *yy);
+YY_RULE(int) yy_GE(yycontext *yy);
+YY_RULE(int) yy_EQ(yycontext *yy);
+YY_RULE(int) yy_CARET(yycontext *yy);
+YY_RULE(int) yy_STAR(yycontext *yy);
+YY_RULE(int) yy_PLUS(yycontext *yy);
+YY_RULE(int) yy_MINUS(yycontext *yy);
+YY_RULE(int) yy_SLASH(yycontext *yy);
+YY_RULE(int) yy_L_PRN(yycontext *yy);
+YY_RULE(int) yy_R_PRN(yycontext *yy);
+YY_RULE(int) yy_ANDPER(yycontext *yy);
+YY_RULE(int) yy_EXCLAM(yycontext *yy);
+YY_RULE(int) yy_PER_0(yycontext *yy);
+YY_RULE(int) yy_PER_1(yycontext *yy);
+YY_RULE(int) yy_PER_2(yycontext *yy);
+YY_RULE(int) yy_PER_3(yycontext *yy);
+YY_RULE(int) yy_DirectiveLine(yycontext *yy);
+YY_RULE(int) yy_IncBinaryDirect(yycontext *yy);
+YY_RULE(int) yy_IncDataDirect(yycontext *yy);
+YY_RULE(int) yy_IncFileName(yycontext *yy);
+YY_RULE(int) yy_IncFileOffset(yycontext *yy);
+YY_RULE(int) yy_IncFileLength(yycontext *yy);
+YY_RULE(int) yy_DefineVariable(yycontext *yy);
+YY_RULE(int) yy_DefineNumeric(yycontext *yy);
+YY_RULE(int) yy_DefineString(yycontext *yy);
+YY_RULE(int) yy_NumDefName(yycontext *yy);
+YY_RULE(int) yy_StrDefName(yycontext *yy);
+YY_RULE(int) yy_OptionsDirective(yycontext *yy);
+YY_RULE(int) yy_OptionList(yycontext *yy);
+YY_RULE(int) yy_ParserOption(yycontext *yy);
+YY_RULE(int) yy_ParserOptionMode(yycontext *yy);
+YY_RULE(int) yy_OptimizeSuboptions(yycontext *yy);
+YY_RULE(int) yy_REM(yycontext *yy);
+YY_RULE(int) yy_DATA(yycontext *yy);
+YY_RULE(int) yy_INPUT(yycontext *yy);
+YY_RULE(int) yy_COLOR(yycontext *yy);
+YY_RULE(int) yy_LIST(yycontext *yy);
+YY_RULE(int) yy_ENTER(yycontext *yy);
+YY_RULE(int) yy_LET(yycontext *yy);
+YY_RULE(int) yy_IF(yycontext *yy);
+YY_RULE(int) yy_FOR(yycontext *yy);
+YY_RULE(int) yy_NEXT(yycontext *yy);
+YY_RULE(int) yy_GOTO(yycontext *yy);
+YY_RULE(int) yy_GO_TO(yycontext *yy);
+YY_RULE(int) yy_GOSUB(yycontext *yy);
+YY_RULE(int) yy_TRAP(yycontext *yy);
+YY_RULE(int) yy_BYE(yycontext *yy);
+YY_RULE(int) yy_CONT(yycontext *yy);
+YY_RULE(int) yy_COM(yycontext *yy);
+YY_RULE(int) yy_CLOSE(yycontext *yy);
+YY_RULE(int) yy_CLR(yycontext *yy);
+YY_RULE(int) yy_DEG(yycontext *yy);
+YY_RULE(int) yy_DIM(yycontext *yy);
+YY_RULE(int) yy_END(yycontext *yy);
+YY_RULE(int) yy_NEW(yycontext *yy);
+YY_RULE(int) yy_OPEN(yycontext *yy);
+YY_RULE(int) yy_LOAD(yycontext *yy);
+YY_RULE(int) yy_SAVE(yycontext *yy);
+YY_RULE(int) yy_STATUS(yycontext *yy);
+YY_RULE(int) yy_NOTE(yycontext *yy);
+YY_RULE(int) yy_POINT(yycontext *yy);
+YY_RULE(int) yy_XIO(yycontext *yy);
+YY_RULE(int) yy_ON(yycontext *yy);
+YY_RULE(int) yy_POKE(yycontext *yy);
+YY_RULE(int) yy_PRINT(yycontext *yy);
+YY_RULE(int) yy_RAD(yycontext *yy);
+YY_RULE(int) yy_READ(yycontext *yy);
+YY_RULE(int) yy_RESTORE(yycontext *yy);
+YY_RULE(int) yy_RETURN(yycontext *yy);
+YY_RULE(int) yy_RUN(yycontext *yy);
+YY_RULE(int) yy_STOP(yycontext *yy);
+YY_RULE(int) yy_POP(yycontext *yy);
+YY_RULE(int) yy_PRINT_(yycontext *yy);
+YY_RULE(int) yy_GET(yycontext *yy);
+YY_RULE(int) yy_PUT(yycontext *yy);
+YY_RULE(int) yy_GRAPHICS(yycontext *yy);
+YY_RULE(int) yy_PLOT(yycontext *yy);
+YY_RULE(int) yy_POSITION(yycontext *yy);
+YY_RULE(int) yy_DOS(yycontext *yy);
+YY_RULE(int) yy_DRAWTO(yycontext *yy);
+YY_RULE(int) yy_SETCOLOR(yycontext *yy);
+YY_RULE(int) yy_LOCATE(yycontext *yy);
+YY_RULE(int) yy_SOUND(yycontext *yy);
+YY_RULE(int) yy_LPRINT(yycontext *yy);
+YY_RULE(int) yy_CSAVE(yycontext *yy);
+YY_RULE(int) yy_CLOAD(yycontext *yy);
+YY_RULE(int) yy_BAS_ERROR(yycontext *yy);
+YY_RULE(int) yy_DPOKE(yycontext *yy);
+YY_RULE(int) yy_MOVE(yycontext *yy);
+YY_RULE(int) yy_N_MOVE(yycontext *yy);
+YY_RULE(int) yy_F_F(yycontext *yy);
+YY_RULE(int) yy_REPEAT(yycontext *yy);
+YY_RULE(int) yy_UNTIL(yycontext *yy);
+YY_RULE(int) yy_WHILE(yycontext *yy);
+YY_RULE(int) yy_WEND(yycontext *yy);
+YY_RULE(int) yy_ELSE(yycontext *yy);
+YY_RULE(int) yy_ENDIF(yycontext *yy);
+YY_RULE(int) yy_BPUT(yycontext *yy);
+YY_RULE(int) yy_BGET(yycontext *yy);
+YY_RULE(int) yy_FILLTO(yycontext *yy);
+YY_RULE(int) yy_DO(yycontext *yy);
+YY_RULE(int) yy_LOOP(yycontext *yy);
+YY_RULE(int) yy_EXIT(yycontext *yy);
+YY_RULE(int) yy_DIR(yycontext *yy);
+YY_RULE(int) yy_LOCK(yycontext *yy);
+YY_RULE(int) yy_UNLOCK(yycontext *yy);
+YY_RULE(int) yy_RENAME(yycontext *yy);
+YY_RULE(int) yy_DELETE(yycontext *yy);
+YY_RULE(int) yy_PAUSE(yycontext *yy);
+YY_RULE(int) yy_TIME_S(yycontext *yy);
+YY_RULE(int) yy_PROC(yycontext *yy);
+YY_RULE(int) yy_EXEC(yycontext *yy);
+YY_RULE(int) yy_ENDPROC(yycontext *yy);
+YY_RULE(int) yy_FCOLOR(yycontext *yy);
+YY_RULE(int) yy_F_L(yycontext *yy);
+YY_RULE(int) yy_REM_(yycontext *yy);
+YY_RULE(int) yy_RENUM(yycontext *yy);
+YY_RULE(int) yy_DEL(yycontext *yy);
+YY_RULE(int) yy_DUMP(yycontext *yy);
+YY_RULE(int) yy_TRACE(yycontext *yy);
+YY_RULE(int) yy_TEXT(yycontext *yy);
+YY_RULE(int) yy_BLOAD(yycontext *yy);
+YY_RULE(int) yy_BRUN(yycontext *yy);
+YY_RULE(int) yy_GO_S(yycontext *yy);
+YY_RULE(int) yy_LBL_S(yycontext *yy);
+YY_RULE(int) yy_F_B(yycontext *yy);
+YY_RULE(int) yy_PAINT(yycontext *yy);
+YY_RULE(int) yy_CLS(yycontext *yy);
+YY_RULE(int) yy_DSOUND(yycontext *yy);
+YY_RULE(int) yy_CIRCLE(yycontext *yy);
+YY_RULE(int) yy_P_PUT(yycontext *yy);
+YY_RULE(int) yy_P_GET(yycontext *yy);
+YY_RULE(int) yy_ON_GOTO(yycontext *yy);
+YY_RULE(int) yy_ON_GOSUB(yycontext *yy);
+YY_RULE(int) yy_FOR_TO(yycontext *yy);
+YY_RULE(int) yy_STEP(yycontext *yy);
+YY_RULE(int) yy_THEN(yycontext *yy);
+YY_RULE(int) yy_NOT(yycontext *yy);
+YY_RULE(int) yy_OR(yycontext *yy);
+YY_RULE(int) yy_AND(yycontext *yy);
+YY_RULE(int) yy_STRP(yycontext *yy);
+YY_RULE(int) yy_CHRP(yycontext *yy);
+YY_RULE(int) yy_USR(yycontext *yy);
+YY_RULE(int) yy_ASC(yycontext *yy);
+YY_RULE(int) yy_VAL(yycontext *yy);
+YY_RULE(int) yy_LEN(yycontext *yy);
+YY_RULE(int) yy_ADR(yycontext *yy);
+YY_RULE(int) yy_ATN(yycontext *yy);
+YY_RULE(int) yy_COS(yycontext *yy);
+YY_RULE(int) yy_PEEK(yycontext *yy);
+YY_RULE(int) yy_SIN(yycontext *yy);
+YY_RULE(int) yy_RND(yycontext *yy);
+YY_RULE(int) yy_FRE(yycontext *yy);
+YY_RULE(int) yy_EXP(yycontext *yy);
+YY_RULE(int) yy_LOG(yycontext *yy);
+YY_RULE(int) yy_CLOG(yycontext *yy);
+YY_RULE(int) yy_SQR(yycontext *yy);
+YY_RULE(int) yy_SGN(yycontext *yy);
+YY_RULE(int) yy_ABS(yycontext *yy);
+YY_RULE(int) yy_INT(yycontext *yy);
+YY_RULE(int) yy_PADDLE(yycontext *yy);
+YY_RULE(int) yy_STICK(yycontext *yy);
+YY_RULE(int) yy_PTRIG(yycontext *yy);
+YY_RULE(int) yy_STRIG(yycontext *yy);
+YY_RULE(int) yy_DPEEK(yycontext *yy);
+YY_RULE(int) yy_INSTR(yycontext *yy);
+YY_RULE(int) yy_INKEYP(yycontext *yy);
+YY_RULE(int) yy_EXOR(yycontext *yy);
+YY_RULE(int) yy_HEXP(yycontext *yy);
+YY_RULE(int) yy_DEC(yycontext *yy);
+YY_RULE(int) yy_DIV(yycontext *yy);
+YY_RULE(int) yy_FRAC(yycontext *yy);
+YY_RULE(int) yy_TIMEP(yycontext *yy);
+YY_RULE(int) yy_TIME(yycontext *yy);
+YY_RULE(int) yy_MOD(yycontext *yy);
+YY_RULE(int) yy_ON_EXEC(yycontext *yy);
+YY_RULE(int) yy_RND_S(yycontext *yy);
+YY_RULE(int) yy_RAND(yycontext *yy);
+YY_RULE(int) yy_TRUNC(yycontext *yy);
+YY_RULE(int) yy_ON_GOSHARP(yycontext *yy);
+YY_RULE(int) yy_UINSTR(yycontext *yy);
+YY_RULE(int) yy_ERR(yycontext *yy);
+YY_RULE(int) yy_ERL(yycontext *yy);
+YY_ACTION(void) yy_1_ProgramLine(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { print_error("input line", yytext); }
+#undef __
+}
+YY_ACTION(void) yy_2_StatementLine(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { print_error("statement", yytext); }
+#undef __
+}
+YY_ACTION(void) yy_3_StatementLine(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { print_error("end of line/statement", yytext); }
+#undef __
+}
+YY_ACTION(void) yy_4_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_REM,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_5_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_REM_,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_6_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_TIME_S,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_7_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_TIME_S,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_8_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_LET_INV,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_9_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_LET_INV,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_10_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_REM,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_11_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_BYE,0); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_12_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_BPUT,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_13_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_BGET,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_14_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_BLOAD,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_15_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_BRUN,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_16_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_COLOR,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_17_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_CONT,0); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_18_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_COM,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_19_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_CLOSE,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_20_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_CLOSE,0); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_21_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_CLR,0); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_22_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  {t=0;}
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_23_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_CLS,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_24_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_CLOAD,0); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_25_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_CIRCLE,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_26_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_CSAVE,0); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_27_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_DATA,add_data_stmt(yytext, yyleng)); add_force_line(); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_28_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_DEG,0); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_29_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_DIM,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_30_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_DOS,0); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_31_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_DRAWTO,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_32_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_DPOKE,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_33_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_DO,0); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_34_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  {t=0;}
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_35_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_DIR,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_36_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_DELETE,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_37_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_DEL,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_38_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  {t=0;}
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_39_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_DUMP,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_40_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  {t=0;}
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_41_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_DSOUND,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_42_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_ENTER,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_43_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_ELSE,0); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_44_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_ENDIF,0); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_45_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_ENDIF_INVISIBLE,0); add_force_line(); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_46_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  {t=0;}
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_47_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_EXIT,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_48_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_EXEC_PAR,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_49_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_EXEC,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_50_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_ENDPROC,0); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_51_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_END,0); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_52_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_FOR,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_53_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_FILLTO,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_54_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_FCOLOR,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_55_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_GOTO,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_56_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_GO_TO,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_57_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_GOSUB,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_58_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_GET,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_59_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_GRAPHICS,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_60_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_GO_S,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_61_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_INPUT,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_62_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_IF_NUMBER,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_63_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { disable_parsing(); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_64_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { enable_parsing(); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_65_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_force_line(); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_66_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_IF_THEN,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_67_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_ENDIF_INVISIBLE,0); add_force_line(); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_68_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_IF_MULTILINE,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_69_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_IF_THEN,ex_bin(t,0,TOK_THEN)); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_70_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { t=0; }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_71_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_LIST,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_72_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_LET,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_73_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_LOAD,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_74_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_LOCATE,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_75_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_LPRINT,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_76_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_LOOP,0); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_77_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_LOCK,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_78_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_MOVE,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_79_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_N_MOVE,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_80_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_NEXT,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_81_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_NEW,0); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_82_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_NOTE,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_83_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_OPEN,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_84_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_ON,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_85_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_POINT,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_86_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_POKE,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_87_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_PRINT,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_88_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_PRINT_,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_89_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_POP,0); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_90_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_PUT,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_91_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_PLOT,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_92_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_POSITION,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_93_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_PAUSE,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_94_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_PROC_VAR,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_95_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_PROC,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_96_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_PAINT,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_97_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_RAD,0); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_98_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_READ,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_99_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_RESTORE,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_100_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_RESTORE,0); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_101_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_RETURN,0); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_102_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_RUN,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_103_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_RUN,0); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_104_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_REPEAT,0); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_105_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_RENAME,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_106_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_RENUM,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_107_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_SAVE,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_108_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_STATUS,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_109_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_STOP,0); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_110_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_SETCOLOR,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_111_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_SOUND,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_112_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_SOUND,0); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_113_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_TRAP,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_114_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_TRACE,0); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_115_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_TEXT,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_116_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_UNTIL,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_117_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_UNLOCK,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_118_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_WHILE,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_119_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_WEND,0); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_120_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_XIO,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_121_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  {t=0;}
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_122_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_F_F,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_123_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  {t=0;}
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_124_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_F_L,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_125_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  {t=0;}
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_126_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_F_B,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_127_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_P_PUT,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_128_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_P_GET,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_129_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_LBL_S,t); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_130_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_BAS_ERROR, add_comment(yytext,yyleng,0)); print_error("statement", yytext); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_131_Statement(yycontext *yy, char *yytext, int yyleng)
+{
+#define t yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_stmt(STMT_BAS_ERROR, add_comment(yytext,yyleng,0)); print_error("statement", yytext); }
+#undef t
+#undef __
+}
+YY_ACTION(void) yy_132_IONumExpr2(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(l,r,TOK_COMMA); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_133_LetExprStr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(l,r,TOK_S_ASGN); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_134_LetExprNum(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(l,r,TOK_F_ASGN); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_135_NumExpr2(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(l,r,TOK_COMMA); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_136_NumExpr2(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { print_error("2 numeric expressions", yytext); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_137_NumExpr3(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(l,r,TOK_COMMA); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_138_NumExpr3(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { print_error("3 numeric expressions", yytext); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_139_NumExpr4(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(l,r,TOK_COMMA); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_140_NumExpr4(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { print_error("4 numeric expressions", yytext); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_141_CircleExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = l; }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_142_CircleExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(l,r,TOK_COMMA); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_143_IOChan(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,r,TOK_SHARP); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_144_IOChanErr(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { print_error("I/O channel (#)", yytext); __ = 0; }
+#undef __
+}
+YY_ACTION(void) yy_145_VarNumComma(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { l = ex_comma(l,r); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_146_VarNumComma(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = l; }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_147_NumComma(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { l = ex_comma(l,r); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_148_NumComma(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = l; }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_149_LabelComma(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { l = ex_comma(l,r); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_150_LabelComma(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = l; }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_151_PrintExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  {l=0;}
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_152_PrintExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { l = ex_bin(l,r,TOK_COMMA); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_153_PrintExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { l = ex_bin(l,r,TOK_SEMICOLON); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_154_PrintExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { l = ex_bin(l,0,TOK_COMMA); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_155_PrintExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { l = ex_bin(l,0,TOK_SEMICOLON); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_156_PrintExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = l; }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_157_FlagExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,0,TOK_MINUS); }
+#undef __
+}
+YY_ACTION(void) yy_158_FlagExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,0,TOK_PLUS); }
+#undef __
+}
+YY_ACTION(void) yy_159_ForStmtExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { l = ex_bin(l,r,TOK_F_ASGN); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_160_ForStmtExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { l = ex_bin(l,r,TOK_FOR_TO); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_161_ForStmtExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { l = ex_bin(l,r,TOK_STEP); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_162_ForStmtExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = l; }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_163_GetExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_comma(l, r); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_164_PutExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_comma(l, r); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_165_PutExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_comma(ex_bin(0,add_number(16),TOK_SHARP), r); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_166_XioExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define n1 yy->__val[-1]
+#define n2 yy->__val[-2]
+#define n3 yy->__val[-3]
+#define n4 yy->__val[-4]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_comma(ex_comma(ex_comma(n1,n2),n3),n4); }
+#undef n1
+#undef n2
+#undef n3
+#undef n4
+#undef __
+}
+YY_ACTION(void) yy_167_StatusExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_comma(l,r); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_168_PrintIoExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { l = ex_bin(l,r, TOK_COMMA); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_169_PrintIoExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { l = ex_bin(l,r, TOK_SEMICOLON); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_170_PrintIoExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = l; }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_171_InputExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_comma(l,r); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_172_InputExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(l,r,TOK_SEMICOLON); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_173_InputExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_comma(l,r); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_174_InputExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(l,r,TOK_SEMICOLON); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_175_IfNumberExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(l,r,TOK_THEN); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_176_IfThenExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(l,0,TOK_THEN); }
+#undef l
+#undef __
+}
+YY_ACTION(void) yy_177_ListExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { l = ex_comma(l,r); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_178_ListExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { l = ex_comma(l,r); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_179_ListExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = l; }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_180_ListExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_comma(l,r); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_181_LocateExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_comma(l,r); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_182_IOVarNumExpr2(yycontext *yy, char *yytext, int yyleng)
+{
+#define n1 yy->__val[-1]
+#define n2 yy->__val[-2]
+#define n3 yy->__val[-3]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_comma(ex_comma(n1,n2),n3); }
+#undef n1
+#undef n2
+#undef n3
+#undef __
+}
+YY_ACTION(void) yy_183_OpenExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define n1 yy->__val[-1]
+#define n2 yy->__val[-2]
+#define n3 yy->__val[-3]
+#define n4 yy->__val[-4]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_comma(ex_comma(ex_comma(n1,n2),n3),n4); }
+#undef n1
+#undef n2
+#undef n3
+#undef n4
+#undef __
+}
+YY_ACTION(void) yy_184_OnExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(l,r,TOK_ON_GOTO); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_185_OnExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(l,r,TOK_ON_GOSUB); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_186_OnExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(l,r,TOK_ON_GOSHARP); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_187_OnExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(l,r,TOK_ON_EXEC); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_188_OnExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { print_error("on goto/gosub/go#/exec", yytext); __ = l; }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_189_LabelOrLNumExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,r,TOK_SHARP); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_190_TextExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_comma(l,r); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_191_ProcVar(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(l,r,TOK_DS_L_PRN); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_192_ProcVar(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { print_error("proc argument", yytext); __ = l; }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_193_ProcVariableList(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { l = ex_comma(l,r); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_194_ProcVariableList(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = l; }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_195_ProcVarList(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define l yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,r,TOK_SEMICOLON); }
+#undef r
+#undef l
+#undef __
+}
+YY_ACTION(void) yy_196_ProcVarList(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define l yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { r = 0; }
+#undef r
+#undef l
+#undef __
+}
+YY_ACTION(void) yy_197_ProcVarList(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define l yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(l,r,TOK_SEMICOLON); }
+#undef r
+#undef l
+#undef __
+}
+YY_ACTION(void) yy_198_LabelProcVarList(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_comma(l,r); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_199_ExecParExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,r,TOK_F_ASGN); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_200_ExecParExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,r,TOK_S_ASGN); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_201_AnyExprList(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { l = ex_comma(l,r); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_202_AnyExprList(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = l; }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_203_LabelExecParList(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_comma(l,r); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_204_VariableList(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { l = ex_comma(l,r); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_205_VariableList(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = l; }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_206_VariableList(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { print_error("numeric or string variable", yytext); __ = 0; }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_207_AssignVarNum(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(l,r,TOK_A_L_PRN); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_208_AssignVarStr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { l = ex_bin(l,r,TOK_S_L_PRN); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_209_AssignVarStr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = l; }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_210_ArrayAccess(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { l = ex_bin(l,r,TOK_A_COMMA); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_211_ArrayAccess(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = l; }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_212_DimVarList(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { l = ex_comma(l,r); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_213_DimVarList(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = l; }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_214_DimVar(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(l,r,TOK_D_L_PRN); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_215_DimVar(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(l,r,TOK_DS_L_PRN); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_216_DimVar(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { print_error("DIM string/array", yytext); __ = 0; }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_217_Label(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = add_ident(yytext, vtLabel);  }
+#undef __
+}
+YY_ACTION(void) yy_218_PVarStr(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = add_ident(yytext, vtString); }
+#undef __
+}
+YY_ACTION(void) yy_219_PVarNum(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = add_ident(yytext, vtFloat);  }
+#undef __
+}
+YY_ACTION(void) yy_220_PVarArray(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = add_ident(yytext, vtArray);  }
+#undef __
+}
+YY_ACTION(void) yy_221_PDimVarArray(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = add_ident(yytext, vtArray);  }
+#undef __
+}
+YY_ACTION(void) yy_222_PDimVarStr(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = add_ident(yytext, vtString); }
+#undef __
+}
+YY_ACTION(void) yy_223_StringDef(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = add_strdef_val(yytext); }
+#undef __
+}
+YY_ACTION(void) yy_224_NumericDef(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = add_numdef_val(yytext); }
+#undef __
+}
+YY_ACTION(void) yy_225_NumExprErr(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { print_error("numeric expression", yytext); __ = 0; }
+#undef __
+}
+YY_ACTION(void) yy_226_StrExprErr(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { print_error("string expression", yytext); __ = 0; }
+#undef __
+}
+YY_ACTION(void) yy_227_StrExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,r,TOK_STRP); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_228_StrExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,r,TOK_CHRP); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_229_StrExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,r,TOK_HEXP); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_230_StrExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,0,TOK_INKEYP); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_231_StrExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,0,TOK_TIMEP); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_232_StringData(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = add_string(); }
+#undef __
+}
+YY_ACTION(void) yy_233_ConstString(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { push_string_const(yytext, yyleng); }
+#undef __
+}
+YY_ACTION(void) yy_234_ExtendedString(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { push_extended_string(yytext, yyleng); }
+#undef __
+}
+YY_ACTION(void) yy_235_ExtendedString(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { print_error("end of extended string (\"])", yytext); }
+#undef __
+}
+YY_ACTION(void) yy_236_NumExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { l = ex_bin(l,r,TOK_OR); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_237_NumExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = l; }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_238_AndExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { l = ex_bin(l,r,TOK_AND); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_239_AndExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = l; }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_240_NotExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,r,TOK_NOT); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_241_CompExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { l = ex_bin(l,r,TOK_N_LEQ); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_242_CompExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { l = ex_bin(l,r,TOK_N_NEQ); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_243_CompExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { l = ex_bin(l,r,TOK_N_GEQ); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_244_CompExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { l = ex_bin(l,r,TOK_N_LE); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_245_CompExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { l = ex_bin(l,r,TOK_N_GE); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_246_CompExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { l = ex_bin(l,r,TOK_N_EQ); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_247_CompExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = l; }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_248_CompRight(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,r,TOK_NOT); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_249_AddExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { l = ex_bin(l,r,TOK_PLUS); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_250_AddExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { l = ex_bin(l,r,TOK_MINUS); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_251_AddExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = l; }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_252_MultExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { l = ex_bin(l,r,TOK_STAR); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_253_MultExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { l = ex_bin(l,r,TOK_SLASH); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_254_MultExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { l = ex_bin(l,r,TOK_DIV); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_255_MultExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { l = ex_bin(l,r,TOK_MOD); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_256_MultExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = l; }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_257_BitExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { l = ex_bin(l,r,TOK_ANDPER); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_258_BitExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { l = ex_bin(l,r,TOK_EXCLAM); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_259_BitExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { l = ex_bin(l,r,TOK_EXOR); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_260_BitExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = l; }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_261_PowExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { l = ex_bin(l,r,TOK_CARET); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_262_PowExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = l; }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_263_NegExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,r,TOK_UMINUS); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_264_NegExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,r,TOK_UPLUS); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_265_UnitExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,r,TOK_L_PRN); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_266_UnitExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,r,TOK_USR); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_267_UnitExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,r,TOK_ASC); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_268_UnitExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,r,TOK_VAL); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_269_UnitExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,r,TOK_LEN); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_270_UnitExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,r,TOK_ADR); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_271_UnitExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,r,TOK_ATN); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_272_UnitExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,r,TOK_COS); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_273_UnitExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,r,TOK_PEEK); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_274_UnitExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,r,TOK_SIN); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_275_UnitExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,r,TOK_RND); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_276_UnitExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,0,TOK_RND_S); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_277_UnitExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,r,TOK_FRE); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_278_UnitExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,r,TOK_EXP); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_279_UnitExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,r,TOK_LOG); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_280_UnitExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,r,TOK_CLOG); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_281_UnitExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,r,TOK_SQR); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_282_UnitExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,r,TOK_SGN); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_283_UnitExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,r,TOK_ABS); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_284_UnitExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,r,TOK_INT); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_285_UnitExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,r,TOK_PADDLE); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_286_UnitExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,r,TOK_STICK); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_287_UnitExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,r,TOK_PTRIG); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_288_UnitExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,r,TOK_STRIG); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_289_UnitExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,r,TOK_DPEEK); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_290_UnitExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,r,TOK_INSTR); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_291_UnitExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,r,TOK_DEC); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_292_UnitExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,r,TOK_FRAC); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_293_UnitExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,r,TOK_RAND); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_294_UnitExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,r,TOK_TRUNC); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_295_UnitExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,r,TOK_UINSTR); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_296_UnitExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,0,TOK_TIME); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_297_UnitExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,0,TOK_ERR); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_298_UnitExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define r yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,0,TOK_ERL); }
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_299_ConstNum(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,0,TOK_PER_0); }
+#undef __
+}
+YY_ACTION(void) yy_300_ConstNum(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,0,TOK_PER_1); }
+#undef __
+}
+YY_ACTION(void) yy_301_ConstNum(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,0,TOK_PER_2); }
+#undef __
+}
+YY_ACTION(void) yy_302_ConstNum(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(0,0,TOK_PER_3); }
+#undef __
+}
+YY_ACTION(void) yy_303_ConstNum(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = add_number(0); }
+#undef __
+}
+YY_ACTION(void) yy_304_ConstNum(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = add_number(1); }
+#undef __
+}
+YY_ACTION(void) yy_305_ConstNum(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = add_number(2); }
+#undef __
+}
+YY_ACTION(void) yy_306_ConstNum(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = add_number(3); }
+#undef __
+}
+YY_ACTION(void) yy_307_StrCompExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(l,r,TOK_S_LEQ); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_308_StrCompExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(l,r,TOK_S_NEQ); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_309_StrCompExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(l,r,TOK_S_GEQ); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_310_StrCompExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(l,r,TOK_S_LE); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_311_StrCompExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(l,r,TOK_S_GE); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_312_StrCompExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = ex_bin(l,r,TOK_S_EQ); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_313_NumAComma(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { l = ex_bin(l,r,TOK_A_COMMA); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_314_NumAComma(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = l; }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_315_ParUsrExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = l; }
+#undef l
+#undef __
+}
+YY_ACTION(void) yy_316_ParUsrExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { print_error("numeric (,numeric) expressions", yytext); __ = 0; }
+#undef l
+#undef __
+}
+YY_ACTION(void) yy_317_ParNumExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = l; }
+#undef l
+#undef __
+}
+YY_ACTION(void) yy_318_ParNumExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { print_error("numeric expression in parenthesis", yytext); __ = 0; }
+#undef l
+#undef __
+}
+YY_ACTION(void) yy_319_ParInstrExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { l = ex_bin(l,r,TOK_A_COMMA); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_320_ParInstrExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { l = ex_bin(l,r,TOK_A_COMMA); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_321_ParInstrExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = l; }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_322_ParInstrExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define r yy->__val[-2]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { print_error("string, string (,numeric) expressions", yytext); }
+#undef l
+#undef r
+#undef __
+}
+YY_ACTION(void) yy_323_ParStrExpr(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = l; }
+#undef l
+#undef __
+}
+YY_ACTION(void) yy_324_EndOfLine(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { inc_file_line(); }
+#undef __
+}
+YY_ACTION(void) yy_325_LineNumber(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_linenum( strtod(yytext,0) ); }
+#undef __
+}
+YY_ACTION(void) yy_326_Number(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = parsingTurbo() ? add_hex_number( strtol(yytext,0,16) ) : add_number( strtol(yytext,0,16) ); }
+#undef __
+}
+YY_ACTION(void) yy_327_Number(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = add_number( strtod(yytext,0) ); }
+#undef __
+}
+YY_ACTION(void) yy_328_RemExpr1(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = add_comment(yytext, yyleng, l); }
+#undef l
+#undef __
+}
+YY_ACTION(void) yy_329_RemExpr2(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = add_comment(yytext, yyleng, l); }
+#undef l
+#undef __
+}
+YY_ACTION(void) yy_330_RemExpr3(yycontext *yy, char *yytext, int yyleng)
+{
+#define l yy->__val[-1]
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = add_comment(yytext, yyleng, l); }
+#undef l
+#undef __
+}
+YY_ACTION(void) yy_331_RemStmt1(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = add_comment(yytext, yyleng, 0); }
+#undef __
+}
+YY_ACTION(void) yy_332_RemStmt2(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = add_comment(yytext, yyleng, 0); }
+#undef __
+}
+YY_ACTION(void) yy_333_RemStmt3(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { __ = add_comment(yytext, yyleng, 0); }
+#undef __
+}
+YY_ACTION(void) yy_334_DirectiveLine(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { print_error("parser directive", yytext); }
+#undef __
+}
+YY_ACTION(void) yy_335_DirectiveLine(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { print_error("end of line", yytext); }
+#undef __
+}
+YY_ACTION(void) yy_336_IncBinaryDirect(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_definition(yytext); }
+#undef __
+}
+YY_ACTION(void) yy_337_IncBinaryDirect(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_incbin_file(0); }
+#undef __
+}
+YY_ACTION(void) yy_338_IncBinaryDirect(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { print_error("$incbin def and file name", yytext); }
+#undef __
+}
+YY_ACTION(void) yy_339_IncDataDirect(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_incbin_file(1); }
+#undef __
+}
+YY_ACTION(void) yy_340_IncDataDirect(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { print_error("$incdata file name", yytext); }
+#undef __
+}
+YY_ACTION(void) yy_341_IncFileName(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { set_incbin_filename(yytext); }
+#undef __
+}
+YY_ACTION(void) yy_342_IncFileOffset(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { set_incbin_offset(strtol(yytext, 0, 16)); }
+#undef __
+}
+YY_ACTION(void) yy_343_IncFileOffset(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { set_incbin_offset(strtol(yytext, 0, 10)); }
+#undef __
+}
+YY_ACTION(void) yy_344_IncFileLength(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { set_incbin_length(strtol(yytext, 0, 16)); }
+#undef __
+}
+YY_ACTION(void) yy_345_IncFileLength(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { set_incbin_length(strtol(yytext, 0, 10)); }
+#undef __
+}
+YY_ACTION(void) yy_346_DefineVariable(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { print_error("definition = value", yytext); }
+#undef __
+}
+YY_ACTION(void) yy_347_DefineNumeric(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_definition(yytext); }
+#undef __
+}
+YY_ACTION(void) yy_348_DefineNumeric(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { set_numdef_value(strtod(yytext,0)); }
+#undef __
+}
+YY_ACTION(void) yy_349_DefineNumeric(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { set_numdef_value(strtol(yytext,0,16)); }
+#undef __
+}
+YY_ACTION(void) yy_350_DefineNumeric(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { print_error("numeric value", yytext); }
+#undef __
+}
+YY_ACTION(void) yy_351_DefineString(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { add_definition(yytext); }
+#undef __
+}
+YY_ACTION(void) yy_352_DefineString(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { set_strdef_value(); }
+#undef __
+}
+YY_ACTION(void) yy_353_DefineString(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { set_strdef_value(); }
+#undef __
+}
+YY_ACTION(void) yy_354_DefineString(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { print_error("string constant", yytext); }
+#undef __
+}
+YY_ACTION(void) yy_355_StrDefName(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { print_error("name ending with '$'", yytext); }
+#undef __
+}
+YY_ACTION(void) yy_356_OptionList(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { print_error("',' or end of line", yytext); }
+#undef __
+}
+YY_ACTION(void) yy_357_ParserOption(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { print_error("'=' and parsing mode", yytext); }
+#undef __
+}
+YY_ACTION(void) yy_358_ParserOption(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { print_error("parsing option name", yytext); }
+#undef __
+}
+YY_ACTION(void) yy_359_ParserOptionMode(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { print_error("parsing mode", yytext); }
+#undef __
+}
+YY_ACTION(void) yy_360_OptimizeSuboptions(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { print_error("optimize option", yytext); }
+#undef __
+}
+YY_ACTION(void) yy_361_OptimizeSuboptions(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+  (void)yytext; (void)yyleng;
+  { print_error("optimize option", yytext); }
+#undef __
+}
+YY_RULE(int) yy_Program(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  int s2_p, s2_t;
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_UnicodeBOM(yy)) goto l2;
+  goto l1;
+  l2: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  l1: ;
+  l3: s2_p = yy->__pos; s2_t = yy->__thunkpos;
+  if (!yy_ProgramLine(yy)) goto l4;
+  goto l3;
+  l4: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  if (!yy_EndOfFile(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_ProgramLine(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  int s2_p, s2_t;
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_EndOfFile(yy)) goto l5;
+  goto fail;
+  l5: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_SPC(yy)) goto fail;
+  s2_p = yy->__pos; s2_t = yy->__thunkpos;
+  if (!yy_EndOfLine(yy)) goto l7;
+  goto l6;
+  l7: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  if (!yymatchChar(yy, 36)) goto l8;
+  if (!yy_SPC(yy)) goto l8;
+  if (!yy_DirectiveLine(yy)) goto l8;
+  goto l6;
+  l8: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  if (!yymatchChar(yy, 58)) goto l9;
+  if (!yy_SPC(yy)) goto l9;
+  if (!yy_StatementLine(yy)) goto l9;
+  if (!yy_EndOfLine(yy)) goto l9;
+  goto l6;
+  l9: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  if (!yy_LineNumber(yy)) goto l10;
+  if (!yy_EndOfLine(yy)) goto l10;
+  goto l6;
+  l10: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  if (!yy_LineNumber(yy)) goto l11;
+  if (!yy_SPC(yy)) goto l11;
+  if (!yy_StatementLine(yy)) goto l11;
+  if (!yy_EndOfLine(yy)) goto l11;
+  goto l6;
+  l11: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  if (!yy_StatementLine(yy)) goto l12;
+  if (!yy_EndOfLine(yy)) goto l12;
+  goto l6;
+  l12: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  yy->__begin = yy->__pos;
+  if (!yy_ERROR(yy)) goto fail;
+  yy->__end = yy->__pos;
+  if (!yy_EndOfLine(yy)) goto fail;
+  yyDo(yy, yy_1_ProgramLine, yy->__begin, yy->__end);
+  l6: ;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_StatementLine(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  int s2_p, s2_t;
+  if (!yy_Statement(yy)) goto fail;
+  l13: s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  s2_p = yy->__pos; s2_t = yy->__thunkpos;
+  if (!yymatchChar(yy, 58)) goto l16;
+  if (!yy_SPC(yy)) goto l16;
+  if (!yy_Statement(yy)) goto l16;
+  goto l15;
+  l16: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  yy->__begin = yy->__pos;
+  if (!yymatchChar(yy, 58)) goto l17;
+  yy->__end = yy->__pos;
+  if (!yy_SPC(yy)) goto l17;
+  yyDo(yy, yy_2_StatementLine, yy->__begin, yy->__end);
+  goto l15;
+  l17: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  yy->__begin = yy->__pos;
+  if (!yy_ERROR(yy)) goto l14;
+  yy->__end = yy->__pos;
+  yyDo(yy, yy_3_StatementLine, yy->__begin, yy->__end);
+  l15: ;
+  goto l13;
+  l14: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_Statement(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  int s2_p, s2_t;
+  int s3_p, s3_t;
+  int s4_p, s4_t;
+  int s5_p, s5_t;
+  int s6_p, s6_t;
+  int s7_p, s7_t;
+  int s8_p, s8_t;
+  int s9_p, s9_t;
+  int s10_p, s10_t;
+  int s11_p, s11_t;
+  int s12_p, s12_t;
+  int s13_p, s13_t;
+  int s14_p, s14_t;
+  int s15_p, s15_t;
+  int s16_p, s16_t;
+  int s17_p, s17_t;
+  int s18_p, s18_t;
+  yyDo(yy, yyPush, 1, 0);
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_RemExpr1(yy)) goto l19;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_4_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l19: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_RemExpr2(yy)) goto l20;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_5_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l20: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_TIME_S(yy)) goto l21;
+  if (!yy_StrExprErr(yy)) goto l21;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_6_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l21: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 1, TOK_TIMEP ) )) goto l22;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto l22;
+  if (!yymatchChar(yy, 61)) goto l22;
+  if (!yy_SPC(yy)) goto l22;
+  if (!yy_StrExprErr(yy)) goto l22;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_7_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l22: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_LetExprStr(yy)) goto l23;
+  yyDo(yy, yySet, -1, 0);
+  s2_p = yy->__pos; s2_t = yy->__thunkpos;
+  if (!yy_THEN(yy)) goto l24;
+  goto l23;
+  l24: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  yyDo(yy, yy_8_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l23: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_LetExprNum(yy)) goto l25;
+  yyDo(yy, yySet, -1, 0);
+  s3_p = yy->__pos; s3_t = yy->__thunkpos;
+  if (!yy_THEN(yy)) goto l26;
+  goto l25;
+  l26: yy->__pos = s3_p; yy->__thunkpos = s3_t;
+  s4_p = yy->__pos; s4_t = yy->__thunkpos;
+  if (!yy_FOR_TO(yy)) goto l27;
+  goto l25;
+  l27: yy->__pos = s4_p; yy->__thunkpos = s4_t;
+  yyDo(yy, yy_9_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l25: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_RemExpr3(yy)) goto l28;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_10_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l28: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_BYE(yy)) goto l29;
+  yyDo(yy, yy_11_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l29: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_BPUT(yy)) goto l30;
+  if (!yy_IONumExpr2(yy)) goto l30;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_12_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l30: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_BGET(yy)) goto l31;
+  if (!yy_IONumExpr2(yy)) goto l31;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_13_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l31: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_BLOAD(yy)) goto l32;
+  if (!yy_StrExprErr(yy)) goto l32;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_14_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l32: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_BRUN(yy)) goto l33;
+  if (!yy_StrExprErr(yy)) goto l33;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_15_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l33: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_COLOR(yy)) goto l34;
+  if (!yy_NumExprErr(yy)) goto l34;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_16_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l34: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_CONT(yy)) goto l35;
+  yyDo(yy, yy_17_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l35: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_COM(yy)) goto l36;
+  if (!yy_DimVarList(yy)) goto l36;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_18_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l36: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_CLOSE(yy)) goto l37;
+  if (!yy_IOChanErr(yy)) goto l37;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_19_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l37: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_CLOSE(yy)) goto l38;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( parsingTurbo() )) goto l38;
+#undef yytext
+#undef yyleng
+  }
+  yyDo(yy, yy_20_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l38: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_CLR(yy)) goto l39;
+  yyDo(yy, yy_21_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l39: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_CLS(yy)) goto l40;
+  yyDo(yy, yy_22_Statement, yy->__begin, yy->__end);
+  s5_p = yy->__pos; s5_t = yy->__thunkpos;
+  if (!yy_IOChanErr(yy)) goto l42;
+  yyDo(yy, yySet, -1, 0);
+  goto l41;
+  l42: yy->__pos = s5_p; yy->__thunkpos = s5_t;
+  l41: ;
+  yyDo(yy, yy_23_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l40: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_CLOAD(yy)) goto l43;
+  yyDo(yy, yy_24_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l43: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_CIRCLE(yy)) goto l44;
+  if (!yy_CircleExpr(yy)) goto l44;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_25_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l44: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_CSAVE(yy)) goto l45;
+  yyDo(yy, yy_26_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l45: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_DATA(yy)) goto l46;
+  yy->__begin = yy->__pos;
+  l47: s6_p = yy->__pos; s6_t = yy->__thunkpos;
+  if (!yy_NotEOL(yy)) goto l48;
+  goto l47;
+  l48: yy->__pos = s6_p; yy->__thunkpos = s6_t;
+  yy->__end = yy->__pos;
+  yyDo(yy, yy_27_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l46: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_DEG(yy)) goto l49;
+  yyDo(yy, yy_28_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l49: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_DIM(yy)) goto l50;
+  if (!yy_DimVarList(yy)) goto l50;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_29_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l50: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_DOS(yy)) goto l51;
+  yyDo(yy, yy_30_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l51: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_DRAWTO(yy)) goto l52;
+  if (!yy_NumExpr2(yy)) goto l52;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_31_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l52: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_DPOKE(yy)) goto l53;
+  if (!yy_NumExpr2(yy)) goto l53;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_32_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l53: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_DO(yy)) goto l54;
+  yyDo(yy, yy_33_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l54: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_DIR(yy)) goto l55;
+  yyDo(yy, yy_34_Statement, yy->__begin, yy->__end);
+  s7_p = yy->__pos; s7_t = yy->__thunkpos;
+  if (!yy_StrExprErr(yy)) goto l57;
+  yyDo(yy, yySet, -1, 0);
+  goto l56;
+  l57: yy->__pos = s7_p; yy->__thunkpos = s7_t;
+  l56: ;
+  yyDo(yy, yy_35_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l55: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_DELETE(yy)) goto l58;
+  if (!yy_StrExprErr(yy)) goto l58;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_36_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l58: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_DEL(yy)) goto l59;
+  if (!yy_NumExpr2(yy)) goto l59;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_37_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l59: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_DUMP(yy)) goto l60;
+  yyDo(yy, yy_38_Statement, yy->__begin, yy->__end);
+  s8_p = yy->__pos; s8_t = yy->__thunkpos;
+  if (!yy_StrExprErr(yy)) goto l62;
+  yyDo(yy, yySet, -1, 0);
+  goto l61;
+  l62: yy->__pos = s8_p; yy->__thunkpos = s8_t;
+  l61: ;
+  yyDo(yy, yy_39_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l60: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_DSOUND(yy)) goto l63;
+  yyDo(yy, yy_40_Statement, yy->__begin, yy->__end);
+  s9_p = yy->__pos; s9_t = yy->__thunkpos;
+  if (!yy_NumExpr4(yy)) goto l65;
+  yyDo(yy, yySet, -1, 0);
+  goto l64;
+  l65: yy->__pos = s9_p; yy->__thunkpos = s9_t;
+  l64: ;
+  yyDo(yy, yy_41_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l63: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_ENTER(yy)) goto l66;
+  if (!yy_StrExprErr(yy)) goto l66;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_42_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l66: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_ELSE(yy)) goto l67;
+  yyDo(yy, yy_43_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l67: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_ENDIF(yy)) goto l68;
+  s10_p = yy->__pos; s10_t = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( parsingTurbo() )) goto l70;
+#undef yytext
+#undef yyleng
+  }
+  yyDo(yy, yy_44_Statement, yy->__begin, yy->__end);
+  goto l69;
+  l70: yy->__pos = s10_p; yy->__thunkpos = s10_t;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( !parsingTurbo() )) goto l68;
+#undef yytext
+#undef yyleng
+  }
+  yyDo(yy, yy_45_Statement, yy->__begin, yy->__end);
+  l69: ;
+  goto l18;
+  l68: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_EXIT(yy)) goto l71;
+  yyDo(yy, yy_46_Statement, yy->__begin, yy->__end);
+  s11_p = yy->__pos; s11_t = yy->__thunkpos;
+  if (!yy_NumExprErr(yy)) goto l73;
+  yyDo(yy, yySet, -1, 0);
+  goto l72;
+  l73: yy->__pos = s11_p; yy->__thunkpos = s11_t;
+  l72: ;
+  yyDo(yy, yy_47_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l71: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_EXEC(yy)) goto l74;
+  if (!yy_LabelExecParList(yy)) goto l74;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_48_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l74: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_EXEC(yy)) goto l75;
+  if (!yy_Label(yy)) goto l75;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_49_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l75: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_ENDPROC(yy)) goto l76;
+  yyDo(yy, yy_50_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l76: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_END(yy)) goto l77;
+  yyDo(yy, yy_51_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l77: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_FOR(yy)) goto l78;
+  if (!yy_ForStmtExpr(yy)) goto l78;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_52_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l78: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_FILLTO(yy)) goto l79;
+  if (!yy_NumExpr2(yy)) goto l79;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_53_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l79: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_FCOLOR(yy)) goto l80;
+  if (!yy_NumExprErr(yy)) goto l80;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_54_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l80: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_GOTO(yy)) goto l81;
+  if (!yy_NumExprErr(yy)) goto l81;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_55_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l81: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_GO_TO(yy)) goto l82;
+  if (!yy_NumExprErr(yy)) goto l82;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_56_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l82: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_GOSUB(yy)) goto l83;
+  if (!yy_NumExprErr(yy)) goto l83;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_57_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l83: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_GET(yy)) goto l84;
+  if (!yy_GetExpr(yy)) goto l84;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_58_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l84: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_GRAPHICS(yy)) goto l85;
+  if (!yy_NumExprErr(yy)) goto l85;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_59_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l85: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_GO_S(yy)) goto l86;
+  if (!yy_Label(yy)) goto l86;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_60_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l86: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_INPUT(yy)) goto l87;
+  if (!yy_InputExpr(yy)) goto l87;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_61_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l87: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_IF(yy)) goto l88;
+  if (!yy_IfNumberExpr(yy)) goto l88;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_62_Statement, yy->__begin, yy->__end);
+  s12_p = yy->__pos; s12_t = yy->__thunkpos;
+  if (!yymatchChar(yy, 58)) goto l90;
+  if (!yy_SPC(yy)) goto l90;
+  yyDo(yy, yy_63_Statement, yy->__begin, yy->__end);
+  if (!yy_StatementLine(yy)) goto l90;
+  yyDo(yy, yy_64_Statement, yy->__begin, yy->__end);
+  goto l89;
+  l90: yy->__pos = s12_p; yy->__thunkpos = s12_t;
+  l89: ;
+  yyDo(yy, yy_65_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l88: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_IF(yy)) goto l91;
+  if (!yy_IfThenExpr(yy)) goto l91;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_66_Statement, yy->__begin, yy->__end);
+  if (!yy_StatementLine(yy)) goto l91;
+  yyDo(yy, yy_67_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l91: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( parsingTurbo() )) goto l92;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_IF(yy)) goto l92;
+  if (!yy_NumExprErr(yy)) goto l92;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_68_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l92: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( !parsingTurbo() )) goto l93;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_IF(yy)) goto l93;
+  if (!yy_NumExprErr(yy)) goto l93;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_69_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l93: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_LIST(yy)) goto l94;
+  yyDo(yy, yy_70_Statement, yy->__begin, yy->__end);
+  s13_p = yy->__pos; s13_t = yy->__thunkpos;
+  if (!yy_ListExpr(yy)) goto l96;
+  yyDo(yy, yySet, -1, 0);
+  goto l95;
+  l96: yy->__pos = s13_p; yy->__thunkpos = s13_t;
+  l95: ;
+  yyDo(yy, yy_71_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l94: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_LET(yy)) goto l97;
+  if (!yy_LetExpr(yy)) goto l97;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_72_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l97: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_LOAD(yy)) goto l98;
+  if (!yy_StrExprErr(yy)) goto l98;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_73_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l98: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_LOCATE(yy)) goto l99;
+  if (!yy_LocateExpr(yy)) goto l99;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_74_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l99: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_LPRINT(yy)) goto l100;
+  if (!yy_PrintExpr(yy)) goto l100;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_75_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l100: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_LOOP(yy)) goto l101;
+  yyDo(yy, yy_76_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l101: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_LOCK(yy)) goto l102;
+  if (!yy_StrExprErr(yy)) goto l102;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_77_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l102: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_MOVE(yy)) goto l103;
+  if (!yy_NumExpr3(yy)) goto l103;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_78_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l103: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_N_MOVE(yy)) goto l104;
+  if (!yy_NumExpr3(yy)) goto l104;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_79_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l104: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_NEXT(yy)) goto l105;
+  if (!yy_PVarNum(yy)) goto l105;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_80_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l105: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_NEW(yy)) goto l106;
+  yyDo(yy, yy_81_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l106: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_NOTE(yy)) goto l107;
+  if (!yy_IOVarNumExpr2(yy)) goto l107;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_82_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l107: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_OPEN(yy)) goto l108;
+  if (!yy_OpenExpr(yy)) goto l108;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_83_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l108: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_ON(yy)) goto l109;
+  if (!yy_OnExpr(yy)) goto l109;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_84_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l109: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_POINT(yy)) goto l110;
+  if (!yy_IONumExpr2(yy)) goto l110;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_85_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l110: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_POKE(yy)) goto l111;
+  if (!yy_NumExpr2(yy)) goto l111;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_86_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l111: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_PRINT(yy)) goto l112;
+  if (!yy_PrintIoExpr(yy)) goto l112;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_87_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l112: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_PRINT_(yy)) goto l113;
+  if (!yy_PrintIoExpr(yy)) goto l113;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_88_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l113: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_POP(yy)) goto l114;
+  yyDo(yy, yy_89_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l114: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_PUT(yy)) goto l115;
+  if (!yy_PutExpr(yy)) goto l115;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_90_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l115: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_PLOT(yy)) goto l116;
+  if (!yy_NumExpr2(yy)) goto l116;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_91_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l116: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_POSITION(yy)) goto l117;
+  if (!yy_NumExpr2(yy)) goto l117;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_92_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l117: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_PAUSE(yy)) goto l118;
+  if (!yy_NumExprErr(yy)) goto l118;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_93_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l118: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_PROC(yy)) goto l119;
+  if (!yy_LabelProcVarList(yy)) goto l119;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_94_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l119: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_PROC(yy)) goto l120;
+  if (!yy_Label(yy)) goto l120;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_95_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l120: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_PAINT(yy)) goto l121;
+  if (!yy_NumExpr2(yy)) goto l121;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_96_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l121: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_RAD(yy)) goto l122;
+  yyDo(yy, yy_97_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l122: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_READ(yy)) goto l123;
+  if (!yy_VariableList(yy)) goto l123;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_98_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l123: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_RESTORE(yy)) goto l124;
+  s14_p = yy->__pos; s14_t = yy->__thunkpos;
+  if (!yy_LabelOrLNumExpr(yy)) goto l126;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_99_Statement, yy->__begin, yy->__end);
+  goto l125;
+  l126: yy->__pos = s14_p; yy->__thunkpos = s14_t;
+  yyDo(yy, yy_100_Statement, yy->__begin, yy->__end);
+  l125: ;
+  goto l18;
+  l124: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_RETURN(yy)) goto l127;
+  yyDo(yy, yy_101_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l127: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_RUN(yy)) goto l128;
+  s15_p = yy->__pos; s15_t = yy->__thunkpos;
+  if (!yy_StrExpr(yy)) goto l130;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_102_Statement, yy->__begin, yy->__end);
+  goto l129;
+  l130: yy->__pos = s15_p; yy->__thunkpos = s15_t;
+  yyDo(yy, yy_103_Statement, yy->__begin, yy->__end);
+  l129: ;
+  goto l18;
+  l128: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_REPEAT(yy)) goto l131;
+  yyDo(yy, yy_104_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l131: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_RENAME(yy)) goto l132;
+  if (!yy_StrExprErr(yy)) goto l132;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_105_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l132: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_RENUM(yy)) goto l133;
+  if (!yy_NumExpr3(yy)) goto l133;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_106_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l133: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_SAVE(yy)) goto l134;
+  if (!yy_StrExprErr(yy)) goto l134;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_107_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l134: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_STATUS(yy)) goto l135;
+  if (!yy_StatusExpr(yy)) goto l135;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_108_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l135: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_STOP(yy)) goto l136;
+  yyDo(yy, yy_109_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l136: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_SETCOLOR(yy)) goto l137;
+  if (!yy_NumExpr3(yy)) goto l137;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_110_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l137: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_SOUND(yy)) goto l138;
+  if (!yy_NumExpr4(yy)) goto l138;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_111_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l138: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_SOUND(yy)) goto l139;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( parsingTurbo() )) goto l139;
+#undef yytext
+#undef yyleng
+  }
+  yyDo(yy, yy_112_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l139: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_TRAP(yy)) goto l140;
+  if (!yy_LabelOrLNumExpr(yy)) goto l140;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_113_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l140: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_TRACE(yy)) goto l141;
+  yyDo(yy, yy_114_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l141: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_TEXT(yy)) goto l142;
+  if (!yy_TextExpr(yy)) goto l142;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_115_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l142: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_UNTIL(yy)) goto l143;
+  if (!yy_NumExprErr(yy)) goto l143;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_116_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l143: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_UNLOCK(yy)) goto l144;
+  if (!yy_StrExprErr(yy)) goto l144;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_117_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l144: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_WHILE(yy)) goto l145;
+  if (!yy_NumExprErr(yy)) goto l145;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_118_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l145: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_WEND(yy)) goto l146;
+  yyDo(yy, yy_119_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l146: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_XIO(yy)) goto l147;
+  if (!yy_XioExpr(yy)) goto l147;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_120_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l147: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_F_F(yy)) goto l148;
+  yyDo(yy, yy_121_Statement, yy->__begin, yy->__end);
+  s16_p = yy->__pos; s16_t = yy->__thunkpos;
+  if (!yy_FlagExpr(yy)) goto l150;
+  yyDo(yy, yySet, -1, 0);
+  goto l149;
+  l150: yy->__pos = s16_p; yy->__thunkpos = s16_t;
+  l149: ;
+  yyDo(yy, yy_122_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l148: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_F_L(yy)) goto l151;
+  yyDo(yy, yy_123_Statement, yy->__begin, yy->__end);
+  s17_p = yy->__pos; s17_t = yy->__thunkpos;
+  if (!yy_FlagExpr(yy)) goto l153;
+  yyDo(yy, yySet, -1, 0);
+  goto l152;
+  l153: yy->__pos = s17_p; yy->__thunkpos = s17_t;
+  l152: ;
+  yyDo(yy, yy_124_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l151: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_F_B(yy)) goto l154;
+  yyDo(yy, yy_125_Statement, yy->__begin, yy->__end);
+  s18_p = yy->__pos; s18_t = yy->__thunkpos;
+  if (!yy_FlagExpr(yy)) goto l156;
+  yyDo(yy, yySet, -1, 0);
+  goto l155;
+  l156: yy->__pos = s18_p; yy->__thunkpos = s18_t;
+  l155: ;
+  yyDo(yy, yy_126_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l154: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_P_PUT(yy)) goto l157;
+  if (!yy_PutExpr(yy)) goto l157;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_127_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l157: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_P_GET(yy)) goto l158;
+  if (!yy_GetExpr(yy)) goto l158;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_128_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l158: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_LBL_S(yy)) goto l159;
+  if (!yy_Label(yy)) goto l159;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_129_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l159: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yy->__begin = yy->__pos;
+  if (!yy_BAS_ERROR(yy)) goto l160;
+  if (!yy_ERROR(yy)) goto l160;
+  yy->__end = yy->__pos;
+  yyDo(yy, yy_130_Statement, yy->__begin, yy->__end);
+  goto l18;
+  l160: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yy->__begin = yy->__pos;
+  if (!yy_ERROR(yy)) goto fail;
+  yy->__end = yy->__pos;
+  yyDo(yy, yy_131_Statement, yy->__begin, yy->__end);
+  l18: ;
+  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_ERROR(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  if (!yymatchClass(yy, (unsigned char *)"\377\331\377\377\376\377\377\373\377\377\377\377\377\377\377\377\377\377\377\367\377\377\377\377\377\377\377\377\377\377\377\377")) goto fail;
+  l161: s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yymatchClass(yy, (unsigned char *)"\377\333\377\377\377\377\377\373\377\377\377\377\377\377\377\377\377\377\377\367\377\377\377\377\377\377\377\377\377\377\377\377")) goto l162;
+  goto l161;
+  l162: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_ERROREXP(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  if (!yymatchClass(yy, (unsigned char *)"\377\331\377\377\376\377\377\373\377\377\377\377\377\377\377\377\377\377\377\367\377\377\377\377\377\377\377\377\377\377\377\377")) goto fail;
+  l163: s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yymatchClass(yy, (unsigned char *)"\377\333\377\377\377\357\377\373\377\377\377\377\377\377\377\377\377\377\377\367\377\377\377\377\377\377\377\377\377\377\377\377")) goto l164;
+  goto l163;
+  l164: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_IONumExpr2(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyDo(yy, yyPush, 2, 0);
+  if (!yy_IOChanErr(yy)) goto fail;
+  yyDo(yy, yySet, -1, 0);
+  if (!yy_COMMA(yy)) goto fail;
+  if (!yy_NumExpr2(yy)) goto fail;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_132_IONumExpr2, yy->__begin, yy->__end);
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_LetExpr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_LetExprStr(yy)) goto l166;
+  goto l165;
+  l166: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_LetExprNum(yy)) goto fail;
+  l165: ;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_LetExprStr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyDo(yy, yyPush, 2, 0);
+  if (!yy_AssignVarStr(yy)) goto fail;
+  yyDo(yy, yySet, -1, 0);
+  if (!yy_EQ(yy)) goto fail;
+  if (!yy_StrExprErr(yy)) goto fail;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_133_LetExprStr, yy->__begin, yy->__end);
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_LetExprNum(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyDo(yy, yyPush, 2, 0);
+  if (!yy_AssignVarNum(yy)) goto fail;
+  yyDo(yy, yySet, -1, 0);
+  if (!yy_EQ(yy)) goto fail;
+  if (!yy_NumExprErr(yy)) goto fail;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_134_LetExprNum, yy->__begin, yy->__end);
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_NumExpr2(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  yyDo(yy, yyPush, 2, 0);
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_NumExprErr(yy)) goto l168;
+  yyDo(yy, yySet, -1, 0);
+  if (!yy_COMMA(yy)) goto l168;
+  if (!yy_NumExprErr(yy)) goto l168;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_135_NumExpr2, yy->__begin, yy->__end);
+  goto l167;
+  l168: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yy->__begin = yy->__pos;
+  if (!yy_ERROR(yy)) goto fail;
+  yy->__end = yy->__pos;
+  yyDo(yy, yy_136_NumExpr2, yy->__begin, yy->__end);
+  l167: ;
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_NumExpr3(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  yyDo(yy, yyPush, 2, 0);
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_NumExpr2(yy)) goto l170;
+  yyDo(yy, yySet, -1, 0);
+  if (!yy_COMMA(yy)) goto l170;
+  if (!yy_NumExprErr(yy)) goto l170;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_137_NumExpr3, yy->__begin, yy->__end);
+  goto l169;
+  l170: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yy->__begin = yy->__pos;
+  if (!yy_ERROR(yy)) goto fail;
+  yy->__end = yy->__pos;
+  yyDo(yy, yy_138_NumExpr3, yy->__begin, yy->__end);
+  l169: ;
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_NumExpr4(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  yyDo(yy, yyPush, 2, 0);
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_NumExpr3(yy)) goto l172;
+  yyDo(yy, yySet, -1, 0);
+  if (!yy_COMMA(yy)) goto l172;
+  if (!yy_NumExprErr(yy)) goto l172;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_139_NumExpr4, yy->__begin, yy->__end);
+  goto l171;
+  l172: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yy->__begin = yy->__pos;
+  if (!yy_ERROR(yy)) goto fail;
+  yy->__end = yy->__pos;
+  yyDo(yy, yy_140_NumExpr4, yy->__begin, yy->__end);
+  l171: ;
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_CircleExpr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  yyDo(yy, yyPush, 2, 0);
+  if (!yy_NumExpr3(yy)) goto fail;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_141_CircleExpr, yy->__begin, yy->__end);
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_COMMA(yy)) goto l174;
+  if (!yy_NumExprErr(yy)) goto l174;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_142_CircleExpr, yy->__begin, yy->__end);
+  goto l173;
+  l174: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  l173: ;
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_IOChan(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyDo(yy, yyPush, 1, 0);
+  if (!yy_SHARP(yy)) goto fail;
+  if (!yy_NumExprErr(yy)) goto fail;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_143_IOChan, yy->__begin, yy->__end);
+  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_IOChanErr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_IOChan(yy)) goto l176;
+  goto l175;
+  l176: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yy->__begin = yy->__pos;
+  if (!yy_ERROREXP(yy)) goto fail;
+  yy->__end = yy->__pos;
+  yyDo(yy, yy_144_IOChanErr, yy->__begin, yy->__end);
+  l175: ;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_AnyExpr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_NumExpr(yy)) goto l178;
+  goto l177;
+  l178: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_StrExpr(yy)) goto fail;
+  l177: ;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_VarNumComma(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  yyDo(yy, yyPush, 2, 0);
+  if (!yy_PVarNum(yy)) goto fail;
+  yyDo(yy, yySet, -1, 0);
+  l179: s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_COMMA(yy)) goto l180;
+  if (!yy_PVarNum(yy)) goto l180;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_145_VarNumComma, yy->__begin, yy->__end);
+  goto l179;
+  l180: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yyDo(yy, yy_146_VarNumComma, yy->__begin, yy->__end);
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_NumComma(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  yyDo(yy, yyPush, 2, 0);
+  if (!yy_NumExprErr(yy)) goto fail;
+  yyDo(yy, yySet, -1, 0);
+  l181: s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_COMMA(yy)) goto l182;
+  if (!yy_NumExprErr(yy)) goto l182;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_147_NumComma, yy->__begin, yy->__end);
+  goto l181;
+  l182: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yyDo(yy, yy_148_NumComma, yy->__begin, yy->__end);
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_LabelComma(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  yyDo(yy, yyPush, 2, 0);
+  if (!yy_Label(yy)) goto fail;
+  yyDo(yy, yySet, -1, 0);
+  l183: s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_COMMA(yy)) goto l184;
+  if (!yy_Label(yy)) goto l184;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_149_LabelComma, yy->__begin, yy->__end);
+  goto l183;
+  l184: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yyDo(yy, yy_150_LabelComma, yy->__begin, yy->__end);
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_PrintExpr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  int s2_p, s2_t;
+  int s3_p, s3_t;
+  yyDo(yy, yyPush, 2, 0);
+  yyDo(yy, yy_151_PrintExpr, yy->__begin, yy->__end);
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_AnyExpr(yy)) goto l186;
+  yyDo(yy, yySet, -1, 0);
+  goto l185;
+  l186: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  l185: ;
+  l187: s2_p = yy->__pos; s2_t = yy->__thunkpos;
+  s3_p = yy->__pos; s3_t = yy->__thunkpos;
+  if (!yy_COMMA(yy)) goto l190;
+  if (!yy_AnyExpr(yy)) goto l190;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_152_PrintExpr, yy->__begin, yy->__end);
+  goto l189;
+  l190: yy->__pos = s3_p; yy->__thunkpos = s3_t;
+  if (!yy_SEMICOLON(yy)) goto l191;
+  if (!yy_AnyExpr(yy)) goto l191;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_153_PrintExpr, yy->__begin, yy->__end);
+  goto l189;
+  l191: yy->__pos = s3_p; yy->__thunkpos = s3_t;
+  if (!yy_COMMA(yy)) goto l192;
+  yyDo(yy, yy_154_PrintExpr, yy->__begin, yy->__end);
+  goto l189;
+  l192: yy->__pos = s3_p; yy->__thunkpos = s3_t;
+  if (!yy_SEMICOLON(yy)) goto l188;
+  yyDo(yy, yy_155_PrintExpr, yy->__begin, yy->__end);
+  l189: ;
+  goto l187;
+  l188: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  yyDo(yy, yy_156_PrintExpr, yy->__begin, yy->__end);
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_FlagExpr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_MINUS(yy)) goto l194;
+  yyDo(yy, yy_157_FlagExpr, yy->__begin, yy->__end);
+  goto l193;
+  l194: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_PLUS(yy)) goto fail;
+  yyDo(yy, yy_158_FlagExpr, yy->__begin, yy->__end);
+  l193: ;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_ForStmtExpr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  yyDo(yy, yyPush, 2, 0);
+  if (!yy_PVarNum(yy)) goto fail;
+  yyDo(yy, yySet, -1, 0);
+  if (!yy_EQ(yy)) goto fail;
+  if (!yy_NumExprErr(yy)) goto fail;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_159_ForStmtExpr, yy->__begin, yy->__end);
+  if (!yy_FOR_TO(yy)) goto fail;
+  if (!yy_NumExprErr(yy)) goto fail;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_160_ForStmtExpr, yy->__begin, yy->__end);
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_STEP(yy)) goto l196;
+  if (!yy_NumExprErr(yy)) goto l196;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_161_ForStmtExpr, yy->__begin, yy->__end);
+  goto l195;
+  l196: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  l195: ;
+  yyDo(yy, yy_162_ForStmtExpr, yy->__begin, yy->__end);
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_GetExpr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  yyDo(yy, yyPush, 2, 0);
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_IOChan(yy)) goto l198;
+  yyDo(yy, yySet, -1, 0);
+  if (!yy_COMMA(yy)) goto l198;
+  if (!yy_VarNumComma(yy)) goto l198;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_163_GetExpr, yy->__begin, yy->__end);
+  goto l197;
+  l198: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( parsingTurbo() )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_VarNumComma(yy)) goto fail;
+  l197: ;
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_PutExpr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  yyDo(yy, yyPush, 2, 0);
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_IOChan(yy)) goto l200;
+  yyDo(yy, yySet, -1, 0);
+  if (!yy_COMMA(yy)) goto l200;
+  if (!yy_NumComma(yy)) goto l200;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_164_PutExpr, yy->__begin, yy->__end);
+  goto l199;
+  l200: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( parsingTurbo() )) goto l201;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_NumComma(yy)) goto l201;
+  goto l199;
+  l201: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_NumComma(yy)) goto fail;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_165_PutExpr, yy->__begin, yy->__end);
+  l199: ;
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_XioExpr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyDo(yy, yyPush, 4, 0);
+  if (!yy_NumExprErr(yy)) goto fail;
+  yyDo(yy, yySet, -1, 0);
+  if (!yy_COMMA(yy)) goto fail;
+  if (!yy_IOChanErr(yy)) goto fail;
+  yyDo(yy, yySet, -2, 0);
+  if (!yy_COMMA(yy)) goto fail;
+  if (!yy_NumExpr2(yy)) goto fail;
+  yyDo(yy, yySet, -3, 0);
+  if (!yy_COMMA(yy)) goto fail;
+  if (!yy_StrExprErr(yy)) goto fail;
+  yyDo(yy, yySet, -4, 0);
+  yyDo(yy, yy_166_XioExpr, yy->__begin, yy->__end);
+  yyDo(yy, yyPop, 4, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_StatusExpr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyDo(yy, yyPush, 2, 0);
+  if (!yy_IOChanErr(yy)) goto fail;
+  yyDo(yy, yySet, -1, 0);
+  if (!yy_COMMA(yy)) goto fail;
+  if (!yy_PVarNum(yy)) goto fail;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_167_StatusExpr, yy->__begin, yy->__end);
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_PrintIoExpr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  int s2_p, s2_t;
+  int s3_p, s3_t;
+  yyDo(yy, yyPush, 2, 0);
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_IOChan(yy)) goto l203;
+  yyDo(yy, yySet, -1, 0);
+  s2_p = yy->__pos; s2_t = yy->__thunkpos;
+  s3_p = yy->__pos; s3_t = yy->__thunkpos;
+  if (!yy_COMMA(yy)) goto l207;
+  if (!yy_PrintExpr(yy)) goto l207;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_168_PrintIoExpr, yy->__begin, yy->__end);
+  goto l206;
+  l207: yy->__pos = s3_p; yy->__thunkpos = s3_t;
+  if (!yy_SEMICOLON(yy)) goto l205;
+  if (!yy_PrintExpr(yy)) goto l205;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_169_PrintIoExpr, yy->__begin, yy->__end);
+  l206: ;
+  goto l204;
+  l205: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  l204: ;
+  yyDo(yy, yy_170_PrintIoExpr, yy->__begin, yy->__end);
+  goto l202;
+  l203: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_PrintExpr(yy)) goto fail;
+  l202: ;
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_InputExpr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  int s2_p, s2_t;
+  yyDo(yy, yyPush, 2, 0);
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_IOChan(yy)) goto l209;
+  yyDo(yy, yySet, -1, 0);
+  if (!yy_COMMA(yy)) goto l209;
+  if (!yy_VariableList(yy)) goto l209;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_171_InputExpr, yy->__begin, yy->__end);
+  goto l208;
+  l209: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_IOChan(yy)) goto l210;
+  yyDo(yy, yySet, -1, 0);
+  if (!yy_SEMICOLON(yy)) goto l210;
+  if (!yy_VariableList(yy)) goto l210;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_172_InputExpr, yy->__begin, yy->__end);
+  goto l208;
+  l210: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( parsingTurbo() )) goto l211;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_StringData(yy)) goto l211;
+  yyDo(yy, yySet, -1, 0);
+  s2_p = yy->__pos; s2_t = yy->__thunkpos;
+  if (!yy_COMMA(yy)) goto l213;
+  if (!yy_VariableList(yy)) goto l213;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_173_InputExpr, yy->__begin, yy->__end);
+  goto l212;
+  l213: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  if (!yy_SEMICOLON(yy)) goto l211;
+  if (!yy_VariableList(yy)) goto l211;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_174_InputExpr, yy->__begin, yy->__end);
+  l212: ;
+  goto l208;
+  l211: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_VariableList(yy)) goto fail;
+  l208: ;
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_IfNumberExpr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyDo(yy, yyPush, 2, 0);
+  if (!yy_NumExprErr(yy)) goto fail;
+  yyDo(yy, yySet, -1, 0);
+  if (!yy_THEN(yy)) goto fail;
+  if (!yy_Number(yy)) goto fail;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_175_IfNumberExpr, yy->__begin, yy->__end);
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_IfThenExpr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyDo(yy, yyPush, 1, 0);
+  if (!yy_NumExprErr(yy)) goto fail;
+  yyDo(yy, yySet, -1, 0);
+  if (!yy_THEN(yy)) goto fail;
+  yyDo(yy, yy_176_IfThenExpr, yy->__begin, yy->__end);
+  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_ListExpr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  int s2_p, s2_t;
+  int s3_p, s3_t;
+  yyDo(yy, yyPush, 2, 0);
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_StrExpr(yy)) goto l215;
+  yyDo(yy, yySet, -1, 0);
+  s2_p = yy->__pos; s2_t = yy->__thunkpos;
+  if (!yy_COMMA(yy)) goto l217;
+  if (!yy_NumExpr(yy)) goto l217;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_177_ListExpr, yy->__begin, yy->__end);
+  s3_p = yy->__pos; s3_t = yy->__thunkpos;
+  if (!yy_COMMA(yy)) goto l219;
+  if (!yy_NumExpr(yy)) goto l219;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_178_ListExpr, yy->__begin, yy->__end);
+  goto l218;
+  l219: yy->__pos = s3_p; yy->__thunkpos = s3_t;
+  l218: ;
+  goto l216;
+  l217: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  l216: ;
+  yyDo(yy, yy_179_ListExpr, yy->__begin, yy->__end);
+  goto l214;
+  l215: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_NumExpr(yy)) goto l220;
+  yyDo(yy, yySet, -1, 0);
+  if (!yy_COMMA(yy)) goto l220;
+  if (!yy_NumExprErr(yy)) goto l220;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_180_ListExpr, yy->__begin, yy->__end);
+  goto l214;
+  l220: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_NumExprErr(yy)) goto fail;
+  l214: ;
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_LocateExpr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyDo(yy, yyPush, 2, 0);
+  if (!yy_NumExpr2(yy)) goto fail;
+  yyDo(yy, yySet, -1, 0);
+  if (!yy_COMMA(yy)) goto fail;
+  if (!yy_PVarNum(yy)) goto fail;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_181_LocateExpr, yy->__begin, yy->__end);
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_IOVarNumExpr2(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyDo(yy, yyPush, 3, 0);
+  if (!yy_IOChanErr(yy)) goto fail;
+  yyDo(yy, yySet, -1, 0);
+  if (!yy_COMMA(yy)) goto fail;
+  if (!yy_PVarNum(yy)) goto fail;
+  yyDo(yy, yySet, -2, 0);
+  if (!yy_COMMA(yy)) goto fail;
+  if (!yy_PVarNum(yy)) goto fail;
+  yyDo(yy, yySet, -3, 0);
+  yyDo(yy, yy_182_IOVarNumExpr2, yy->__begin, yy->__end);
+  yyDo(yy, yyPop, 3, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_OpenExpr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyDo(yy, yyPush, 4, 0);
+  if (!yy_IOChanErr(yy)) goto fail;
+  yyDo(yy, yySet, -1, 0);
+  if (!yy_COMMA(yy)) goto fail;
+  if (!yy_NumExprErr(yy)) goto fail;
+  yyDo(yy, yySet, -2, 0);
+  if (!yy_COMMA(yy)) goto fail;
+  if (!yy_NumExprErr(yy)) goto fail;
+  yyDo(yy, yySet, -3, 0);
+  if (!yy_COMMA(yy)) goto fail;
+  if (!yy_StrExprErr(yy)) goto fail;
+  yyDo(yy, yySet, -4, 0);
+  yyDo(yy, yy_183_OpenExpr, yy->__begin, yy->__end);
+  yyDo(yy, yyPop, 4, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_OnExpr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  yyDo(yy, yyPush, 2, 0);
+  if (!yy_NumExprErr(yy)) goto fail;
+  yyDo(yy, yySet, -1, 0);
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_ON_GOTO(yy)) goto l222;
+  if (!yy_NumComma(yy)) goto l222;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_184_OnExpr, yy->__begin, yy->__end);
+  goto l221;
+  l222: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_ON_GOSUB(yy)) goto l223;
+  if (!yy_NumComma(yy)) goto l223;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_185_OnExpr, yy->__begin, yy->__end);
+  goto l221;
+  l223: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_ON_GOSHARP(yy)) goto l224;
+  if (!yy_LabelComma(yy)) goto l224;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_186_OnExpr, yy->__begin, yy->__end);
+  goto l221;
+  l224: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_ON_EXEC(yy)) goto l225;
+  if (!yy_LabelComma(yy)) goto l225;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_187_OnExpr, yy->__begin, yy->__end);
+  goto l221;
+  l225: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yy->__begin = yy->__pos;
+  if (!yy_ERROR(yy)) goto fail;
+  yy->__end = yy->__pos;
+  yyDo(yy, yy_188_OnExpr, yy->__begin, yy->__end);
+  l221: ;
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_LabelOrLNumExpr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  yyDo(yy, yyPush, 1, 0);
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_SHARP(yy)) goto l227;
+  if (!yy_Label(yy)) goto l227;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_189_LabelOrLNumExpr, yy->__begin, yy->__end);
+  goto l226;
+  l227: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_NumExprErr(yy)) goto fail;
+  l226: ;
+  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_TextExpr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyDo(yy, yyPush, 2, 0);
+  if (!yy_NumExpr2(yy)) goto fail;
+  yyDo(yy, yySet, -1, 0);
+  if (!yy_COMMA(yy)) goto fail;
+  if (!yy_AnyExpr(yy)) goto fail;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_190_TextExpr, yy->__begin, yy->__end);
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_ProcVar(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  yyDo(yy, yyPush, 2, 0);
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_PVarNum(yy)) goto l229;
+  goto l228;
+  l229: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_PDimVarStr(yy)) goto l230;
+  yyDo(yy, yySet, -1, 0);
+  if (!yy_ConstNum(yy)) goto l230;
+  yyDo(yy, yySet, -2, 0);
+  if (!yy_R_PRN(yy)) goto l230;
+  yyDo(yy, yy_191_ProcVar, yy->__begin, yy->__end);
+  goto l228;
+  l230: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yy->__begin = yy->__pos;
+  if (!yy_ERROR(yy)) goto fail;
+  yy->__end = yy->__pos;
+  yyDo(yy, yy_192_ProcVar, yy->__begin, yy->__end);
+  l228: ;
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_ProcVariableList(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  yyDo(yy, yyPush, 2, 0);
+  if (!yy_ProcVar(yy)) goto fail;
+  yyDo(yy, yySet, -1, 0);
+  l231: s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_COMMA(yy)) goto l232;
+  if (!yy_ProcVar(yy)) goto l232;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_193_ProcVariableList, yy->__begin, yy->__end);
+  goto l231;
+  l232: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yyDo(yy, yy_194_ProcVariableList, yy->__begin, yy->__end);
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_ProcVarList(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  int s2_p, s2_t;
+  int s3_p, s3_t;
+  int s4_p, s4_t;
+  yyDo(yy, yyPush, 2, 0);
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  s2_p = yy->__pos; s2_t = yy->__thunkpos;
+  if (!yy_COMMA(yy)) goto l236;
+  goto l235;
+  l236: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  l235: ;
+  if (!yy_SEMICOLON(yy)) goto l234;
+  if (!yy_ProcVariableList(yy)) goto l234;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_195_ProcVarList, yy->__begin, yy->__end);
+  goto l233;
+  l234: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_COMMA(yy)) goto fail;
+  if (!yy_ProcVariableList(yy)) goto fail;
+  yyDo(yy, yySet, -2, 0);
+  s3_p = yy->__pos; s3_t = yy->__thunkpos;
+  s4_p = yy->__pos; s4_t = yy->__thunkpos;
+  if (!yy_SEMICOLON(yy)) goto l240;
+  if (!yy_ProcVariableList(yy)) goto l240;
+  yyDo(yy, yySet, -1, 0);
+  goto l239;
+  l240: yy->__pos = s4_p; yy->__thunkpos = s4_t;
+  yyDo(yy, yy_196_ProcVarList, yy->__begin, yy->__end);
+  l239: ;
+  goto l237;
+  l238: yy->__pos = s3_p; yy->__thunkpos = s3_t;
+  l237: ;
+  yyDo(yy, yy_197_ProcVarList, yy->__begin, yy->__end);
+  l233: ;
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_LabelProcVarList(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyDo(yy, yyPush, 2, 0);
+  if (!yy_Label(yy)) goto fail;
+  yyDo(yy, yySet, -1, 0);
+  if (!yy_ProcVarList(yy)) goto fail;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_198_LabelProcVarList, yy->__begin, yy->__end);
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_ExecParExpr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  yyDo(yy, yyPush, 1, 0);
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_NumExpr(yy)) goto l242;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_199_ExecParExpr, yy->__begin, yy->__end);
+  goto l241;
+  l242: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_StrExpr(yy)) goto fail;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_200_ExecParExpr, yy->__begin, yy->__end);
+  l241: ;
+  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_AnyExprList(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  yyDo(yy, yyPush, 2, 0);
+  if (!yy_ExecParExpr(yy)) goto fail;
+  yyDo(yy, yySet, -1, 0);
+  l243: s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_COMMA(yy)) goto l244;
+  if (!yy_ExecParExpr(yy)) goto l244;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_201_AnyExprList, yy->__begin, yy->__end);
+  goto l243;
+  l244: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yyDo(yy, yy_202_AnyExprList, yy->__begin, yy->__end);
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_LabelExecParList(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyDo(yy, yyPush, 2, 0);
+  if (!yy_Label(yy)) goto fail;
+  yyDo(yy, yySet, -1, 0);
+  if (!yy_COMMA(yy)) goto fail;
+  if (!yy_AnyExprList(yy)) goto fail;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_203_LabelExecParList, yy->__begin, yy->__end);
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_VariableList(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  int s2_p, s2_t;
+  yyDo(yy, yyPush, 2, 0);
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_PVarNumStr(yy)) goto l246;
+  yyDo(yy, yySet, -1, 0);
+  l247: s2_p = yy->__pos; s2_t = yy->__thunkpos;
+  if (!yy_COMMA(yy)) goto l248;
+  if (!yy_PVarNumStr(yy)) goto l248;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_204_VariableList, yy->__begin, yy->__end);
+  goto l247;
+  l248: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  yyDo(yy, yy_205_VariableList, yy->__begin, yy->__end);
+  goto l245;
+  l246: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yy->__begin = yy->__pos;
+  if (!yy_ERROR(yy)) goto fail;
+  yy->__end = yy->__pos;
+  yyDo(yy, yy_206_VariableList, yy->__begin, yy->__end);
+  l245: ;
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_PVarNumStr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_PVarNum(yy)) goto l250;
+  goto l249;
+  l250: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_PVarStr(yy)) goto fail;
+  l249: ;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_AssignVarNum(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  yyDo(yy, yyPush, 2, 0);
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_PVarArray(yy)) goto l252;
+  yyDo(yy, yySet, -1, 0);
+  if (!yy_ArrayAccess(yy)) goto l252;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_207_AssignVarNum, yy->__begin, yy->__end);
+  goto l251;
+  l252: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_PVarNum(yy)) goto fail;
+  l251: ;
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_AssignVarStr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  yyDo(yy, yyPush, 2, 0);
+  if (!yy_PVarStr(yy)) goto fail;
+  yyDo(yy, yySet, -1, 0);
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_L_PRN(yy)) goto l254;
+  if (!yy_ArrayAccess(yy)) goto l254;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_208_AssignVarStr, yy->__begin, yy->__end);
+  goto l253;
+  l254: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  l253: ;
+  yyDo(yy, yy_209_AssignVarStr, yy->__begin, yy->__end);
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_ArrayAccess(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  yyDo(yy, yyPush, 2, 0);
+  if (!yy_NumExprErr(yy)) goto fail;
+  yyDo(yy, yySet, -1, 0);
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_COMMA(yy)) goto l256;
+  if (!yy_NumExprErr(yy)) goto l256;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_210_ArrayAccess, yy->__begin, yy->__end);
+  goto l255;
+  l256: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  l255: ;
+  if (!yy_R_PRN(yy)) goto fail;
+  yyDo(yy, yy_211_ArrayAccess, yy->__begin, yy->__end);
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_DimVarList(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  yyDo(yy, yyPush, 2, 0);
+  if (!yy_DimVar(yy)) goto fail;
+  yyDo(yy, yySet, -1, 0);
+  l257: s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_COMMA(yy)) goto l258;
+  if (!yy_DimVar(yy)) goto l258;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_212_DimVarList, yy->__begin, yy->__end);
+  goto l257;
+  l258: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yyDo(yy, yy_213_DimVarList, yy->__begin, yy->__end);
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_DimVar(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  yyDo(yy, yyPush, 2, 0);
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_PDimVarArray(yy)) goto l260;
+  yyDo(yy, yySet, -1, 0);
+  if (!yy_ArrayAccess(yy)) goto l260;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_214_DimVar, yy->__begin, yy->__end);
+  goto l259;
+  l260: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_PDimVarStr(yy)) goto l261;
+  yyDo(yy, yySet, -1, 0);
+  if (!yy_NumExpr(yy)) goto l261;
+  yyDo(yy, yySet, -2, 0);
+  if (!yy_R_PRN(yy)) goto l261;
+  yyDo(yy, yy_215_DimVar, yy->__begin, yy->__end);
+  goto l259;
+  l261: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yy->__begin = yy->__pos;
+  if (!yy_ERROREXP(yy)) goto fail;
+  yy->__end = yy->__pos;
+  yyDo(yy, yy_216_DimVar, yy->__begin, yy->__end);
+  l259: ;
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_Label(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yy->__begin = yy->__pos;
+  if (!yy_Identifier(yy)) goto fail;
+  yy->__end = yy->__pos;
+  if (!yy_SPC(yy)) goto fail;
+  yyDo(yy, yy_217_Label, yy->__begin, yy->__end);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_PVarStr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yy->__begin = yy->__pos;
+  if (!yy_Identifier(yy)) goto fail;
+  yy->__end = yy->__pos;
+  if (!yymatchChar(yy, 36)) goto fail;
+  if (!yy_SPC(yy)) goto fail;
+  yyDo(yy, yy_218_PVarStr, yy->__begin, yy->__end);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_PVarNum(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  yy->__begin = yy->__pos;
+  if (!yy_Identifier(yy)) goto fail;
+  yy->__end = yy->__pos;
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\020\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l262;
+  goto fail;
+  l262: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_SPC(yy)) goto fail;
+  yyDo(yy, yy_219_PVarNum, yy->__begin, yy->__end);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_PVarArray(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yy->__begin = yy->__pos;
+  if (!yy_Identifier(yy)) goto fail;
+  yy->__end = yy->__pos;
+  if (!yy_L_PRN(yy)) goto fail;
+  if (!yy_SPC(yy)) goto fail;
+  yyDo(yy, yy_220_PVarArray, yy->__begin, yy->__end);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_PDimVarArray(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yy->__begin = yy->__pos;
+  if (!yy_Identifier(yy)) goto fail;
+  yy->__end = yy->__pos;
+  if (!yy_L_PRN(yy)) goto fail;
+  if (!yy_SPC(yy)) goto fail;
+  yyDo(yy, yy_221_PDimVarArray, yy->__begin, yy->__end);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_PDimVarStr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yy->__begin = yy->__pos;
+  if (!yy_Identifier(yy)) goto fail;
+  yy->__end = yy->__pos;
+  if (!yymatchChar(yy, 36)) goto fail;
+  if (!yy_SPC(yy)) goto fail;
+  if (!yy_L_PRN(yy)) goto fail;
+  if (!yy_SPC(yy)) goto fail;
+  yyDo(yy, yy_222_PDimVarStr, yy->__begin, yy->__end);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_StringDef(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  if (!yymatchChar(yy, 64)) goto fail;
+  yy->__begin = yy->__pos;
+  if (!yy_Identifier(yy)) goto fail;
+  yy->__end = yy->__pos;
+  if (!yymatchChar(yy, 36)) goto fail;
+  yyDo(yy, yy_223_StringDef, yy->__begin, yy->__end);
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_NumericDef(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  if (!yymatchChar(yy, 64)) goto fail;
+  yy->__begin = yy->__pos;
+  if (!yy_Identifier(yy)) goto fail;
+  yy->__end = yy->__pos;
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yymatchChar(yy, 36)) goto l263;
+  goto fail;
+  l263: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yyDo(yy, yy_224_NumericDef, yy->__begin, yy->__end);
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_NumExprErr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_NumExpr(yy)) goto l265;
+  goto l264;
+  l265: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yy->__begin = yy->__pos;
+  if (!yy_ERROREXP(yy)) goto fail;
+  yy->__end = yy->__pos;
+  yyDo(yy, yy_225_NumExprErr, yy->__begin, yy->__end);
+  l264: ;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_StrExprErr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_StrExpr(yy)) goto l267;
+  goto l266;
+  l267: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yy->__begin = yy->__pos;
+  if (!yy_ERROREXP(yy)) goto fail;
+  yy->__end = yy->__pos;
+  yyDo(yy, yy_226_StrExprErr, yy->__begin, yy->__end);
+  l266: ;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_StrExpr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  yyDo(yy, yyPush, 1, 0);
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_STRP(yy)) goto l269;
+  if (!yy_ParNumExpr(yy)) goto l269;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_227_StrExpr, yy->__begin, yy->__end);
+  goto l268;
+  l269: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_CHRP(yy)) goto l270;
+  if (!yy_ParNumExpr(yy)) goto l270;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_228_StrExpr, yy->__begin, yy->__end);
+  goto l268;
+  l270: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_HEXP(yy)) goto l271;
+  if (!yy_ParNumExpr(yy)) goto l271;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_229_StrExpr, yy->__begin, yy->__end);
+  goto l268;
+  l271: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_INKEYP(yy)) goto l272;
+  yyDo(yy, yy_230_StrExpr, yy->__begin, yy->__end);
+  goto l268;
+  l272: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_TIMEP(yy)) goto l273;
+  yyDo(yy, yy_231_StrExpr, yy->__begin, yy->__end);
+  goto l268;
+  l273: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_StringData(yy)) goto l274;
+  goto l268;
+  l274: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_StringDef(yy)) goto l275;
+  goto l268;
+  l275: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_AssignVarStr(yy)) goto fail;
+  l268: ;
+  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_StringData(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_ConstString(yy)) goto l277;
+  goto l276;
+  l277: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_ExtendedString(yy)) goto fail;
+  l276: ;
+  yyDo(yy, yy_232_StringData, yy->__begin, yy->__end);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_ConstString(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  int s2_p, s2_t;
+  int s3_p, s3_t;
+  if (!yymatchChar(yy, 34)) goto fail;
+  yy->__begin = yy->__pos;
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_StrContent(yy)) goto l279;
+  goto l278;
+  l279: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  l278: ;
+  l280: s2_p = yy->__pos; s2_t = yy->__thunkpos;
+  if (!yymatchChar(yy, 34)) goto l281;
+  if (!yymatchChar(yy, 34)) goto l281;
+  s3_p = yy->__pos; s3_t = yy->__thunkpos;
+  if (!yy_StrContent(yy)) goto l283;
+  goto l282;
+  l283: yy->__pos = s3_p; yy->__thunkpos = s3_t;
+  l282: ;
+  goto l280;
+  l281: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  yy->__end = yy->__pos;
+  yyDo(yy, yy_233_ConstString, yy->__begin, yy->__end);
+  if (!yymatchChar(yy, 34)) goto fail;
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_StrContent(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  if (!yymatchClass(yy, (unsigned char *)"\377\377\377\377\373\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto fail;
+  l284: s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yymatchClass(yy, (unsigned char *)"\377\377\377\377\373\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377")) goto l285;
+  goto l284;
+  l285: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_ExtStringStart(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  if (!yymatchChar(yy, 91)) goto fail;
+  if (!yymatchChar(yy, 34)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_ExtStringEnd(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  if (!yymatchChar(yy, 34)) goto fail;
+  if (!yymatchChar(yy, 93)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_ExtendedString(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  int s2_p, s2_t;
+  int s3_p, s3_t;
+  if (!yy_ExtStringStart(yy)) goto fail;
+  yy->__begin = yy->__pos;
+  l286: s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  s2_p = yy->__pos; s2_t = yy->__thunkpos;
+  if (!yy_ExtStringEnd(yy)) goto l288;
+  goto l287;
+  l288: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  if (!yymatchDot(yy)) goto l287;
+  goto l286;
+  l287: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yy->__end = yy->__pos;
+  s3_p = yy->__pos; s3_t = yy->__thunkpos;
+  if (!yy_ExtStringEnd(yy)) goto l290;
+  yyDo(yy, yy_234_ExtendedString, yy->__begin, yy->__end);
+  goto l289;
+  l290: yy->__pos = s3_p; yy->__thunkpos = s3_t;
+  if (!yy_EndOfFile(yy)) goto fail;
+  yyDo(yy, yy_235_ExtendedString, yy->__begin, yy->__end);
+  l289: ;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_NumExpr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  yyDo(yy, yyPush, 2, 0);
+  if (!yy_AndExpr(yy)) goto fail;
+  yyDo(yy, yySet, -1, 0);
+  l291: s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_OR(yy)) goto l292;
+  if (!yy_AndExpr(yy)) goto l292;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_236_NumExpr, yy->__begin, yy->__end);
+  goto l291;
+  l292: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yyDo(yy, yy_237_NumExpr, yy->__begin, yy->__end);
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_AndExpr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  yyDo(yy, yyPush, 2, 0);
+  if (!yy_NotExpr(yy)) goto fail;
+  yyDo(yy, yySet, -1, 0);
+  l293: s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_AND(yy)) goto l294;
+  if (!yy_NotExpr(yy)) goto l294;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_238_AndExpr, yy->__begin, yy->__end);
+  goto l293;
+  l294: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yyDo(yy, yy_239_AndExpr, yy->__begin, yy->__end);
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_NotExpr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  yyDo(yy, yyPush, 1, 0);
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_NOT(yy)) goto l296;
+  if (!yy_NotExpr(yy)) goto l296;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_240_NotExpr, yy->__begin, yy->__end);
+  goto l295;
+  l296: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_CompExpr(yy)) goto fail;
+  l295: ;
+  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_CompExpr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  int s2_p, s2_t;
+  yyDo(yy, yyPush, 2, 0);
+  if (!yy_AddExpr(yy)) goto fail;
+  yyDo(yy, yySet, -1, 0);
+  l297: s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  s2_p = yy->__pos; s2_t = yy->__thunkpos;
+  if (!yy_LEQ(yy)) goto l300;
+  if (!yy_CompRight(yy)) goto l300;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_241_CompExpr, yy->__begin, yy->__end);
+  goto l299;
+  l300: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  if (!yy_NEQ(yy)) goto l301;
+  if (!yy_CompRight(yy)) goto l301;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_242_CompExpr, yy->__begin, yy->__end);
+  goto l299;
+  l301: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  if (!yy_GEQ(yy)) goto l302;
+  if (!yy_CompRight(yy)) goto l302;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_243_CompExpr, yy->__begin, yy->__end);
+  goto l299;
+  l302: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  if (!yy_LE(yy)) goto l303;
+  if (!yy_CompRight(yy)) goto l303;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_244_CompExpr, yy->__begin, yy->__end);
+  goto l299;
+  l303: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  if (!yy_GE(yy)) goto l304;
+  if (!yy_CompRight(yy)) goto l304;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_245_CompExpr, yy->__begin, yy->__end);
+  goto l299;
+  l304: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  if (!yy_EQ(yy)) goto l298;
+  if (!yy_CompRight(yy)) goto l298;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_246_CompExpr, yy->__begin, yy->__end);
+  l299: ;
+  goto l297;
+  l298: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yyDo(yy, yy_247_CompExpr, yy->__begin, yy->__end);
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_CompRight(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  yyDo(yy, yyPush, 1, 0);
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_NOT(yy)) goto l306;
+  if (!yy_NotExpr(yy)) goto l306;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_248_CompRight, yy->__begin, yy->__end);
+  goto l305;
+  l306: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_AddExpr(yy)) goto fail;
+  l305: ;
+  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_AddExpr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  int s2_p, s2_t;
+  yyDo(yy, yyPush, 2, 0);
+  if (!yy_MultExpr(yy)) goto fail;
+  yyDo(yy, yySet, -1, 0);
+  l307: s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  s2_p = yy->__pos; s2_t = yy->__thunkpos;
+  if (!yy_PLUS(yy)) goto l310;
+  if (!yy_MultExpr(yy)) goto l310;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_249_AddExpr, yy->__begin, yy->__end);
+  goto l309;
+  l310: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  if (!yy_MINUS(yy)) goto l308;
+  if (!yy_MultExpr(yy)) goto l308;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_250_AddExpr, yy->__begin, yy->__end);
+  l309: ;
+  goto l307;
+  l308: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yyDo(yy, yy_251_AddExpr, yy->__begin, yy->__end);
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_MultExpr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  int s2_p, s2_t;
+  yyDo(yy, yyPush, 2, 0);
+  if (!yy_BitExpr(yy)) goto fail;
+  yyDo(yy, yySet, -1, 0);
+  l311: s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  s2_p = yy->__pos; s2_t = yy->__thunkpos;
+  if (!yy_STAR(yy)) goto l314;
+  if (!yy_BitExpr(yy)) goto l314;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_252_MultExpr, yy->__begin, yy->__end);
+  goto l313;
+  l314: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  if (!yy_SLASH(yy)) goto l315;
+  if (!yy_BitExpr(yy)) goto l315;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_253_MultExpr, yy->__begin, yy->__end);
+  goto l313;
+  l315: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  if (!yy_DIV(yy)) goto l316;
+  if (!yy_BitExpr(yy)) goto l316;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_254_MultExpr, yy->__begin, yy->__end);
+  goto l313;
+  l316: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  if (!yy_MOD(yy)) goto l312;
+  if (!yy_BitExpr(yy)) goto l312;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_255_MultExpr, yy->__begin, yy->__end);
+  l313: ;
+  goto l311;
+  l312: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yyDo(yy, yy_256_MultExpr, yy->__begin, yy->__end);
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_BitExpr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  int s2_p, s2_t;
+  yyDo(yy, yyPush, 2, 0);
+  if (!yy_PowExpr(yy)) goto fail;
+  yyDo(yy, yySet, -1, 0);
+  l317: s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  s2_p = yy->__pos; s2_t = yy->__thunkpos;
+  if (!yy_ANDPER(yy)) goto l320;
+  if (!yy_PowExpr(yy)) goto l320;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_257_BitExpr, yy->__begin, yy->__end);
+  goto l319;
+  l320: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  if (!yy_EXCLAM(yy)) goto l321;
+  if (!yy_PowExpr(yy)) goto l321;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_258_BitExpr, yy->__begin, yy->__end);
+  goto l319;
+  l321: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  if (!yy_EXOR(yy)) goto l318;
+  if (!yy_PowExpr(yy)) goto l318;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_259_BitExpr, yy->__begin, yy->__end);
+  l319: ;
+  goto l317;
+  l318: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yyDo(yy, yy_260_BitExpr, yy->__begin, yy->__end);
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_PowExpr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  yyDo(yy, yyPush, 2, 0);
+  if (!yy_NegExpr(yy)) goto fail;
+  yyDo(yy, yySet, -1, 0);
+  l322: s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_CARET(yy)) goto l323;
+  if (!yy_NegExpr(yy)) goto l323;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_261_PowExpr, yy->__begin, yy->__end);
+  goto l322;
+  l323: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yyDo(yy, yy_262_PowExpr, yy->__begin, yy->__end);
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_NegExpr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  yyDo(yy, yyPush, 1, 0);
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_MINUS(yy)) goto l325;
+  if (!yy_NegExpr(yy)) goto l325;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_263_NegExpr, yy->__begin, yy->__end);
+  goto l324;
+  l325: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_PLUS(yy)) goto l326;
+  if (!yy_NegExpr(yy)) goto l326;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_264_NegExpr, yy->__begin, yy->__end);
+  goto l324;
+  l326: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_UnitExpr(yy)) goto fail;
+  l324: ;
+  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_UnitExpr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  int s2_p, s2_t;
+  yyDo(yy, yyPush, 1, 0);
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_ConstNum(yy)) goto l328;
+  goto l327;
+  l328: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_StrCompExpr(yy)) goto l329;
+  goto l327;
+  l329: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_L_PRN(yy)) goto l330;
+  if (!yy_NumExpr(yy)) goto l330;
+  yyDo(yy, yySet, -1, 0);
+  if (!yy_R_PRN(yy)) goto l330;
+  yyDo(yy, yy_265_UnitExpr, yy->__begin, yy->__end);
+  goto l327;
+  l330: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_USR(yy)) goto l331;
+  if (!yy_ParUsrExpr(yy)) goto l331;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_266_UnitExpr, yy->__begin, yy->__end);
+  goto l327;
+  l331: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_ASC(yy)) goto l332;
+  if (!yy_ParStrExpr(yy)) goto l332;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_267_UnitExpr, yy->__begin, yy->__end);
+  goto l327;
+  l332: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_VAL(yy)) goto l333;
+  if (!yy_ParStrExpr(yy)) goto l333;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_268_UnitExpr, yy->__begin, yy->__end);
+  goto l327;
+  l333: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_LEN(yy)) goto l334;
+  if (!yy_ParStrExpr(yy)) goto l334;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_269_UnitExpr, yy->__begin, yy->__end);
+  goto l327;
+  l334: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_ADR(yy)) goto l335;
+  if (!yy_ParStrExpr(yy)) goto l335;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_270_UnitExpr, yy->__begin, yy->__end);
+  goto l327;
+  l335: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_ATN(yy)) goto l336;
+  if (!yy_ParNumExpr(yy)) goto l336;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_271_UnitExpr, yy->__begin, yy->__end);
+  goto l327;
+  l336: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_COS(yy)) goto l337;
+  if (!yy_ParNumExpr(yy)) goto l337;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_272_UnitExpr, yy->__begin, yy->__end);
+  goto l327;
+  l337: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_PEEK(yy)) goto l338;
+  if (!yy_ParNumExpr(yy)) goto l338;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_273_UnitExpr, yy->__begin, yy->__end);
+  goto l327;
+  l338: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_SIN(yy)) goto l339;
+  if (!yy_ParNumExpr(yy)) goto l339;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_274_UnitExpr, yy->__begin, yy->__end);
+  goto l327;
+  l339: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_RND(yy)) goto l340;
+  if (!yy_ParNumExpr(yy)) goto l340;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_275_UnitExpr, yy->__begin, yy->__end);
+  goto l327;
+  l340: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_RND_S(yy)) goto l341;
+  yyDo(yy, yy_276_UnitExpr, yy->__begin, yy->__end);
+  goto l327;
+  l341: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_FRE(yy)) goto l342;
+  if (!yy_ParNumExpr(yy)) goto l342;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_277_UnitExpr, yy->__begin, yy->__end);
+  goto l327;
+  l342: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_EXP(yy)) goto l343;
+  if (!yy_ParNumExpr(yy)) goto l343;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_278_UnitExpr, yy->__begin, yy->__end);
+  goto l327;
+  l343: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_LOG(yy)) goto l344;
+  if (!yy_ParNumExpr(yy)) goto l344;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_279_UnitExpr, yy->__begin, yy->__end);
+  goto l327;
+  l344: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_CLOG(yy)) goto l345;
+  if (!yy_ParNumExpr(yy)) goto l345;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_280_UnitExpr, yy->__begin, yy->__end);
+  goto l327;
+  l345: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_SQR(yy)) goto l346;
+  if (!yy_ParNumExpr(yy)) goto l346;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_281_UnitExpr, yy->__begin, yy->__end);
+  goto l327;
+  l346: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_SGN(yy)) goto l347;
+  if (!yy_ParNumExpr(yy)) goto l347;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_282_UnitExpr, yy->__begin, yy->__end);
+  goto l327;
+  l347: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_ABS(yy)) goto l348;
+  if (!yy_ParNumExpr(yy)) goto l348;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_283_UnitExpr, yy->__begin, yy->__end);
+  goto l327;
+  l348: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_INT(yy)) goto l349;
+  if (!yy_ParNumExpr(yy)) goto l349;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_284_UnitExpr, yy->__begin, yy->__end);
+  goto l327;
+  l349: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_PADDLE(yy)) goto l350;
+  if (!yy_ParNumExpr(yy)) goto l350;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_285_UnitExpr, yy->__begin, yy->__end);
+  goto l327;
+  l350: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_STICK(yy)) goto l351;
+  if (!yy_ParNumExpr(yy)) goto l351;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_286_UnitExpr, yy->__begin, yy->__end);
+  goto l327;
+  l351: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_PTRIG(yy)) goto l352;
+  if (!yy_ParNumExpr(yy)) goto l352;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_287_UnitExpr, yy->__begin, yy->__end);
+  goto l327;
+  l352: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_STRIG(yy)) goto l353;
+  if (!yy_ParNumExpr(yy)) goto l353;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_288_UnitExpr, yy->__begin, yy->__end);
+  goto l327;
+  l353: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_DPEEK(yy)) goto l354;
+  if (!yy_ParNumExpr(yy)) goto l354;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_289_UnitExpr, yy->__begin, yy->__end);
+  goto l327;
+  l354: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_INSTR(yy)) goto l355;
+  if (!yy_ParInstrExpr(yy)) goto l355;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_290_UnitExpr, yy->__begin, yy->__end);
+  goto l327;
+  l355: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_DEC(yy)) goto l356;
+  if (!yy_ParStrExpr(yy)) goto l356;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_291_UnitExpr, yy->__begin, yy->__end);
+  goto l327;
+  l356: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_FRAC(yy)) goto l357;
+  if (!yy_ParNumExpr(yy)) goto l357;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_292_UnitExpr, yy->__begin, yy->__end);
+  goto l327;
+  l357: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_RAND(yy)) goto l358;
+  if (!yy_ParNumExpr(yy)) goto l358;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_293_UnitExpr, yy->__begin, yy->__end);
+  goto l327;
+  l358: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_TRUNC(yy)) goto l359;
+  if (!yy_ParNumExpr(yy)) goto l359;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_294_UnitExpr, yy->__begin, yy->__end);
+  goto l327;
+  l359: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_UINSTR(yy)) goto l360;
+  if (!yy_ParInstrExpr(yy)) goto l360;
+  yyDo(yy, yySet, -1, 0);
+  yyDo(yy, yy_295_UnitExpr, yy->__begin, yy->__end);
+  goto l327;
+  l360: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_TIME(yy)) goto l361;
+  s2_p = yy->__pos; s2_t = yy->__thunkpos;
+  if (!yymatchChar(yy, 36)) goto l362;
+  goto l361;
+  l362: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  yyDo(yy, yy_296_UnitExpr, yy->__begin, yy->__end);
+  goto l327;
+  l361: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_ERR(yy)) goto l363;
+  yyDo(yy, yy_297_UnitExpr, yy->__begin, yy->__end);
+  goto l327;
+  l363: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_ERL(yy)) goto l364;
+  yyDo(yy, yy_298_UnitExpr, yy->__begin, yy->__end);
+  goto l327;
+  l364: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_AssignVarNum(yy)) goto fail;
+  l327: ;
+  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_ConstNum(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  int s2_p, s2_t;
+  int s3_p, s3_t;
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_Number(yy)) goto l366;
+  goto l365;
+  l366: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_NumericDef(yy)) goto l367;
+  goto l365;
+  l367: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( parsingTurbo() )) goto l368;
+#undef yytext
+#undef yyleng
+  }
+  s2_p = yy->__pos; s2_t = yy->__thunkpos;
+  if (!yy_PER_0(yy)) goto l370;
+  yyDo(yy, yy_299_ConstNum, yy->__begin, yy->__end);
+  goto l369;
+  l370: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  if (!yy_PER_1(yy)) goto l371;
+  yyDo(yy, yy_300_ConstNum, yy->__begin, yy->__end);
+  goto l369;
+  l371: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  if (!yy_PER_2(yy)) goto l372;
+  yyDo(yy, yy_301_ConstNum, yy->__begin, yy->__end);
+  goto l369;
+  l372: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  if (!yy_PER_3(yy)) goto l368;
+  yyDo(yy, yy_302_ConstNum, yy->__begin, yy->__end);
+  l369: ;
+  goto l365;
+  l368: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( !parsingTurbo() )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  s3_p = yy->__pos; s3_t = yy->__thunkpos;
+  if (!yy_PER_0(yy)) goto l374;
+  yyDo(yy, yy_303_ConstNum, yy->__begin, yy->__end);
+  goto l373;
+  l374: yy->__pos = s3_p; yy->__thunkpos = s3_t;
+  if (!yy_PER_1(yy)) goto l375;
+  yyDo(yy, yy_304_ConstNum, yy->__begin, yy->__end);
+  goto l373;
+  l375: yy->__pos = s3_p; yy->__thunkpos = s3_t;
+  if (!yy_PER_2(yy)) goto l376;
+  yyDo(yy, yy_305_ConstNum, yy->__begin, yy->__end);
+  goto l373;
+  l376: yy->__pos = s3_p; yy->__thunkpos = s3_t;
+  if (!yy_PER_3(yy)) goto fail;
+  yyDo(yy, yy_306_ConstNum, yy->__begin, yy->__end);
+  l373: ;
+  l365: ;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_StrCompExpr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  yyDo(yy, yyPush, 2, 0);
+  if (!yy_StrExpr(yy)) goto fail;
+  yyDo(yy, yySet, -1, 0);
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_LEQ(yy)) goto l378;
+  if (!yy_StrExprErr(yy)) goto l378;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_307_StrCompExpr, yy->__begin, yy->__end);
+  goto l377;
+  l378: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_NEQ(yy)) goto l379;
+  if (!yy_StrExprErr(yy)) goto l379;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_308_StrCompExpr, yy->__begin, yy->__end);
+  goto l377;
+  l379: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_GEQ(yy)) goto l380;
+  if (!yy_StrExprErr(yy)) goto l380;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_309_StrCompExpr, yy->__begin, yy->__end);
+  goto l377;
+  l380: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_LE(yy)) goto l381;
+  if (!yy_StrExprErr(yy)) goto l381;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_310_StrCompExpr, yy->__begin, yy->__end);
+  goto l377;
+  l381: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_GE(yy)) goto l382;
+  if (!yy_StrExprErr(yy)) goto l382;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_311_StrCompExpr, yy->__begin, yy->__end);
+  goto l377;
+  l382: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_EQ(yy)) goto fail;
+  if (!yy_StrExprErr(yy)) goto fail;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_312_StrCompExpr, yy->__begin, yy->__end);
+  l377: ;
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_NumAComma(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  yyDo(yy, yyPush, 2, 0);
+  if (!yy_NumExprErr(yy)) goto fail;
+  yyDo(yy, yySet, -1, 0);
+  l383: s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_COMMA(yy)) goto l384;
+  if (!yy_NumExprErr(yy)) goto l384;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_313_NumAComma, yy->__begin, yy->__end);
+  goto l383;
+  l384: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yyDo(yy, yy_314_NumAComma, yy->__begin, yy->__end);
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_ParUsrExpr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  yyDo(yy, yyPush, 1, 0);
+  if (!yy_L_PRN(yy)) goto fail;
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_NumAComma(yy)) goto l386;
+  yyDo(yy, yySet, -1, 0);
+  if (!yy_R_PRN(yy)) goto l386;
+  yyDo(yy, yy_315_ParUsrExpr, yy->__begin, yy->__end);
+  goto l385;
+  l386: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yy->__begin = yy->__pos;
+  if (!yy_ERROREXP(yy)) goto fail;
+  yy->__end = yy->__pos;
+  yyDo(yy, yy_316_ParUsrExpr, yy->__begin, yy->__end);
+  l385: ;
+  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_ParNumExpr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  yyDo(yy, yyPush, 1, 0);
+  if (!yy_L_PRN(yy)) goto fail;
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_NumExpr(yy)) goto l388;
+  yyDo(yy, yySet, -1, 0);
+  if (!yy_R_PRN(yy)) goto l388;
+  yyDo(yy, yy_317_ParNumExpr, yy->__begin, yy->__end);
+  goto l387;
+  l388: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yy->__begin = yy->__pos;
+  if (!yy_ERROREXP(yy)) goto fail;
+  yy->__end = yy->__pos;
+  yyDo(yy, yy_318_ParNumExpr, yy->__begin, yy->__end);
+  l387: ;
+  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_ParInstrExpr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  int s2_p, s2_t;
+  yyDo(yy, yyPush, 2, 0);
+  if (!yy_L_PRN(yy)) goto fail;
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_StrExpr(yy)) goto l390;
+  yyDo(yy, yySet, -1, 0);
+  if (!yy_COMMA(yy)) goto l390;
+  if (!yy_StrExpr(yy)) goto l390;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_319_ParInstrExpr, yy->__begin, yy->__end);
+  s2_p = yy->__pos; s2_t = yy->__thunkpos;
+  if (!yy_COMMA(yy)) goto l392;
+  if (!yy_NumExpr(yy)) goto l392;
+  yyDo(yy, yySet, -2, 0);
+  yyDo(yy, yy_320_ParInstrExpr, yy->__begin, yy->__end);
+  goto l391;
+  l392: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  l391: ;
+  if (!yy_R_PRN(yy)) goto l390;
+  yyDo(yy, yy_321_ParInstrExpr, yy->__begin, yy->__end);
+  goto l389;
+  l390: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yy->__begin = yy->__pos;
+  if (!yy_ERROREXP(yy)) goto fail;
+  yy->__end = yy->__pos;
+  yyDo(yy, yy_322_ParInstrExpr, yy->__begin, yy->__end);
+  l389: ;
+  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_ParStrExpr(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyDo(yy, yyPush, 1, 0);
+  if (!yy_L_PRN(yy)) goto fail;
+  if (!yy_StrExprErr(yy)) goto fail;
+  yyDo(yy, yySet, -1, 0);
+  if (!yy_R_PRN(yy)) goto fail;
+  yyDo(yy, yy_323_ParStrExpr, yy->__begin, yy->__end);
+  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_SPC(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  l393: s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yymatchClass(yy, (unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l394;
+  goto l393;
+  l394: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_EndOfLine(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yymatchChar(yy, 10)) goto l396;
+  goto l395;
+  l396: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yymatchChar(yy, 155)) goto l397;
+  goto l395;
+  l397: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yymatchString(yy, "\015\012")) goto l398;
+  goto l395;
+  l398: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yymatchChar(yy, 13)) goto l399;
+  goto l395;
+  l399: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_EndOfFile(yy)) goto fail;
+  l395: ;
+  yyDo(yy, yy_324_EndOfLine, yy->__begin, yy->__end);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_NotEOL(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  if (!yymatchClass(yy, (unsigned char *)"\377\333\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\367\377\377\377\377\377\377\377\377\377\377\377\377")) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_EndOfFile(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yymatchDot(yy)) goto l400;
+  goto fail;
+  l400: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_UnicodeBOM(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  if (!yymatchString(yy, "\357\273\277")) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_LineNumber(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  int s2_p, s2_t;
+  int s3_p, s3_t;
+  int s4_p, s4_t;
+  int s5_p, s5_t;
+  int s6_p, s6_t;
+  int s7_p, s7_t;
+  int s8_p, s8_t;
+  int s9_p, s9_t;
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  yy->__begin = yy->__pos;
+  s2_p = yy->__pos; s2_t = yy->__thunkpos;
+  if (!yymatchChar(yy, 45)) goto l404;
+  goto l403;
+  l404: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  l403: ;
+  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l402;
+  l405: s3_p = yy->__pos; s3_t = yy->__thunkpos;
+  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l406;
+  goto l405;
+  l406: yy->__pos = s3_p; yy->__thunkpos = s3_t;
+  s4_p = yy->__pos; s4_t = yy->__thunkpos;
+  if (!yymatchChar(yy, 46)) goto l408;
+  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l408;
+  l409: s5_p = yy->__pos; s5_t = yy->__thunkpos;
+  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l410;
+  goto l409;
+  l410: yy->__pos = s5_p; yy->__thunkpos = s5_t;
+  goto l407;
+  l408: yy->__pos = s4_p; yy->__thunkpos = s4_t;
+  l407: ;
+  s6_p = yy->__pos; s6_t = yy->__thunkpos;
+  if (!yy_NumExp(yy)) goto l412;
+  goto l411;
+  l412: yy->__pos = s6_p; yy->__thunkpos = s6_t;
+  l411: ;
+  yy->__end = yy->__pos;
+  if (!yy_SPC(yy)) goto l402;
+  goto l401;
+  l402: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yy->__begin = yy->__pos;
+  s7_p = yy->__pos; s7_t = yy->__thunkpos;
+  if (!yymatchChar(yy, 45)) goto l414;
+  goto l413;
+  l414: yy->__pos = s7_p; yy->__thunkpos = s7_t;
+  l413: ;
+  if (!yymatchChar(yy, 46)) goto fail;
+  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto fail;
+  l415: s8_p = yy->__pos; s8_t = yy->__thunkpos;
+  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l416;
+  goto l415;
+  l416: yy->__pos = s8_p; yy->__thunkpos = s8_t;
+  s9_p = yy->__pos; s9_t = yy->__thunkpos;
+  if (!yy_NumExp(yy)) goto l418;
+  goto l417;
+  l418: yy->__pos = s9_p; yy->__thunkpos = s9_t;
+  l417: ;
+  yy->__end = yy->__pos;
+  if (!yy_SPC(yy)) goto fail;
+  l401: ;
+  yyDo(yy, yy_325_LineNumber, yy->__begin, yy->__end);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_IdentifierInit(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\000\000\376\377\377\207\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_IdentifierChar(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\207\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_Identifier(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  if (!yy_IdentifierInit(yy)) goto fail;
+  l419: s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_IdentifierChar(yy)) goto l420;
+  goto l419;
+  l420: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_Number(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_HexNumber(yy)) goto l422;
+  yyDo(yy, yy_326_Number, yy->__begin, yy->__end);
+  goto l421;
+  l422: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_DecNumber(yy)) goto fail;
+  yyDo(yy, yy_327_Number, yy->__begin, yy->__end);
+  l421: ;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_HexNumber(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  if (!yymatchChar(yy, 36)) goto fail;
+  yy->__begin = yy->__pos;
+  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto fail;
+  l423: s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l424;
+  goto l423;
+  l424: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yy->__end = yy->__pos;
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_IntNumber(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  yy->__begin = yy->__pos;
+  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto fail;
+  l425: s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l426;
+  goto l425;
+  l426: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yy->__end = yy->__pos;
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_DecNumber(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  int s2_p, s2_t;
+  int s3_p, s3_t;
+  int s4_p, s4_t;
+  int s5_p, s5_t;
+  int s6_p, s6_t;
+  int s7_p, s7_t;
+  int s8_p, s8_t;
+  int s9_p, s9_t;
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  yy->__begin = yy->__pos;
+  s2_p = yy->__pos; s2_t = yy->__thunkpos;
+  if (!yymatchChar(yy, 45)) goto l430;
+  goto l429;
+  l430: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  l429: ;
+  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l428;
+  l431: s3_p = yy->__pos; s3_t = yy->__thunkpos;
+  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l432;
+  goto l431;
+  l432: yy->__pos = s3_p; yy->__thunkpos = s3_t;
+  s4_p = yy->__pos; s4_t = yy->__thunkpos;
+  if (!yymatchChar(yy, 46)) goto l434;
+  l435: s5_p = yy->__pos; s5_t = yy->__thunkpos;
+  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l436;
+  goto l435;
+  l436: yy->__pos = s5_p; yy->__thunkpos = s5_t;
+  goto l433;
+  l434: yy->__pos = s4_p; yy->__thunkpos = s4_t;
+  l433: ;
+  s6_p = yy->__pos; s6_t = yy->__thunkpos;
+  if (!yy_NumExp(yy)) goto l438;
+  goto l437;
+  l438: yy->__pos = s6_p; yy->__thunkpos = s6_t;
+  l437: ;
+  yy->__end = yy->__pos;
+  if (!yy_SPC(yy)) goto l428;
+  goto l427;
+  l428: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yy->__begin = yy->__pos;
+  s7_p = yy->__pos; s7_t = yy->__thunkpos;
+  if (!yymatchChar(yy, 45)) goto l440;
+  goto l439;
+  l440: yy->__pos = s7_p; yy->__thunkpos = s7_t;
+  l439: ;
+  if (!yymatchChar(yy, 46)) goto fail;
+  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto fail;
+  l441: s8_p = yy->__pos; s8_t = yy->__thunkpos;
+  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l442;
+  goto l441;
+  l442: yy->__pos = s8_p; yy->__thunkpos = s8_t;
+  s9_p = yy->__pos; s9_t = yy->__thunkpos;
+  if (!yy_NumExp(yy)) goto l444;
+  goto l443;
+  l444: yy->__pos = s9_p; yy->__thunkpos = s9_t;
+  l443: ;
+  yy->__end = yy->__pos;
+  if (!yy_SPC(yy)) goto fail;
+  l427: ;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_NumExp(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  int s2_p, s2_t;
+  int s3_p, s3_t;
+  int s4_p, s4_t;
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yymatchChar(yy, 101)) goto l446;
+  goto l445;
+  l446: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yymatchChar(yy, 69)) goto fail;
+  l445: ;
+  s2_p = yy->__pos; s2_t = yy->__thunkpos;
+  s3_p = yy->__pos; s3_t = yy->__thunkpos;
+  if (!yymatchChar(yy, 43)) goto l450;
+  goto l449;
+  l450: yy->__pos = s3_p; yy->__thunkpos = s3_t;
+  if (!yymatchChar(yy, 45)) goto l448;
+  l449: ;
+  goto l447;
+  l448: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  l447: ;
+  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto fail;
+  s4_p = yy->__pos; s4_t = yy->__thunkpos;
+  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l452;
+  goto l451;
+  l452: yy->__pos = s4_p; yy->__thunkpos = s4_t;
+  l451: ;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_RemExpr1(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  yyDo(yy, yyPush, 1, 0);
+  if (!yy_RemStmt1(yy)) goto fail;
+  yyDo(yy, yySet, -1, 0);
+  yy->__begin = yy->__pos;
+  l453: s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_NotEOL(yy)) goto l454;
+  goto l453;
+  l454: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yy->__end = yy->__pos;
+  yyDo(yy, yy_328_RemExpr1, yy->__begin, yy->__end);
+  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_RemExpr2(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  yyDo(yy, yyPush, 1, 0);
+  if (!yy_RemStmt2(yy)) goto fail;
+  yyDo(yy, yySet, -1, 0);
+  yy->__begin = yy->__pos;
+  l455: s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_NotEOL(yy)) goto l456;
+  goto l455;
+  l456: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yy->__end = yy->__pos;
+  yyDo(yy, yy_329_RemExpr2, yy->__begin, yy->__end);
+  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_RemExpr3(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  yyDo(yy, yyPush, 1, 0);
+  if (!yy_RemStmt3(yy)) goto fail;
+  yyDo(yy, yySet, -1, 0);
+  yy->__begin = yy->__pos;
+  l457: s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_NotEOL(yy)) goto l458;
+  goto l457;
+  l458: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yy->__end = yy->__pos;
+  yyDo(yy, yy_330_RemExpr3, yy->__begin, yy->__end);
+  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_RemStmt1(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yy->__begin = yy->__pos;
+  if (!yy_REM_C(yy)) goto fail;
+  if (!yy_SPC(yy)) goto fail;
+  yy->__end = yy->__pos;
+  yyDo(yy, yy_331_RemStmt1, yy->__begin, yy->__end);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_RemStmt2(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yy->__begin = yy->__pos;
+  if (!yy_REM_(yy)) goto fail;
+  if (!yy_SPC(yy)) goto fail;
+  yy->__end = yy->__pos;
+  yyDo(yy, yy_332_RemStmt2, yy->__begin, yy->__end);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_RemStmt3(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yy->__begin = yy->__pos;
+  if (!yy_REM(yy)) goto fail;
+  if (!yy_SPC(yy)) goto fail;
+  yy->__end = yy->__pos;
+  yyDo(yy, yy_333_RemStmt3, yy->__begin, yy->__end);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_REM_C(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  if (!yymatchChar(yy, 39)) goto fail;
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_COMMA(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  if (!yymatchChar(yy, 44)) goto fail;
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_SEMICOLON(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  if (!yymatchChar(yy, 59)) goto fail;
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_SHARP(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  if (!yymatchChar(yy, 35)) goto fail;
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_LEQ(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  if (!yymatchString(yy, "\074\075")) goto fail;
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_NEQ(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  if (!yymatchString(yy, "\074\076")) goto fail;
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_GEQ(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  if (!yymatchString(yy, "\076\075")) goto fail;
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_LE(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  if (!yymatchChar(yy, 60)) goto fail;
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_GE(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  if (!yymatchChar(yy, 62)) goto fail;
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_EQ(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  if (!yymatchChar(yy, 61)) goto fail;
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_CARET(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  if (!yymatchChar(yy, 94)) goto fail;
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_STAR(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  if (!yymatchChar(yy, 42)) goto fail;
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_PLUS(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  if (!yymatchChar(yy, 43)) goto fail;
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_MINUS(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  if (!yymatchChar(yy, 45)) goto fail;
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_SLASH(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  if (!yymatchChar(yy, 47)) goto fail;
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_L_PRN(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  if (!yymatchChar(yy, 40)) goto fail;
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_R_PRN(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  if (!yymatchChar(yy, 41)) goto fail;
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_ANDPER(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( parsingTurbo() )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yymatchChar(yy, 38)) goto fail;
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_EXCLAM(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( parsingTurbo() )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yymatchChar(yy, 33)) goto fail;
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_PER_0(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  if (!yymatchString(yy, "\045\060")) goto fail;
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_PER_1(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  if (!yymatchString(yy, "\045\061")) goto fail;
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_PER_2(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  if (!yymatchString(yy, "\045\062")) goto fail;
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_PER_3(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  if (!yymatchString(yy, "\045\063")) goto fail;
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_DirectiveLine(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  int s2_p, s2_t;
+  int s3_p, s3_t;
+  int s4_p, s4_t;
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_OptionsDirective(yy)) goto l460;
+  goto l459;
+  l460: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_IncBinaryDirect(yy)) goto l461;
+  goto l459;
+  l461: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_IncDataDirect(yy)) goto l462;
+  goto l459;
+  l462: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_DefineVariable(yy)) goto l463;
+  goto l459;
+  l463: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yy->__begin = yy->__pos;
+  if (!yy_ERROR(yy)) goto fail;
+  yy->__end = yy->__pos;
+  yyDo(yy, yy_334_DirectiveLine, yy->__begin, yy->__end);
+  l459: ;
+  if (!yy_SPC(yy)) goto fail;
+  s2_p = yy->__pos; s2_t = yy->__thunkpos;
+  if (!yy_EndOfLine(yy)) goto l465;
+  goto l464;
+  l465: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  yy->__begin = yy->__pos;
+  l466: s3_p = yy->__pos; s3_t = yy->__thunkpos;
+  s4_p = yy->__pos; s4_t = yy->__thunkpos;
+  if (!yy_EndOfLine(yy)) goto l468;
+  goto l467;
+  l468: yy->__pos = s4_p; yy->__thunkpos = s4_t;
+  if (!yymatchDot(yy)) goto l467;
+  goto l466;
+  l467: yy->__pos = s3_p; yy->__thunkpos = s3_t;
+  yy->__end = yy->__pos;
+  yyDo(yy, yy_335_DirectiveLine, yy->__begin, yy->__end);
+  l464: ;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_IncBinaryDirect(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  int s2_p, s2_t;
+  int s3_p, s3_t;
+  if (!yymatchString(yy, "\151\156\143\142\151\156")) goto fail;
+  if (!yy_SPC(yy)) goto fail;
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_StrDefName(yy)) goto l470;
+  yyDo(yy, yy_336_IncBinaryDirect, yy->__begin, yy->__end);
+  if (!yy_SPC(yy)) goto l470;
+  if (!yymatchChar(yy, 44)) goto l470;
+  if (!yy_SPC(yy)) goto l470;
+  if (!yy_IncFileName(yy)) goto l470;
+  if (!yy_SPC(yy)) goto l470;
+  s2_p = yy->__pos; s2_t = yy->__thunkpos;
+  if (!yymatchChar(yy, 44)) goto l472;
+  if (!yy_SPC(yy)) goto l472;
+  if (!yy_IncFileOffset(yy)) goto l472;
+  s3_p = yy->__pos; s3_t = yy->__thunkpos;
+  if (!yymatchChar(yy, 44)) goto l474;
+  if (!yy_SPC(yy)) goto l474;
+  if (!yy_IncFileLength(yy)) goto l474;
+  goto l473;
+  l474: yy->__pos = s3_p; yy->__thunkpos = s3_t;
+  l473: ;
+  goto l471;
+  l472: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  l471: ;
+  yyDo(yy, yy_337_IncBinaryDirect, yy->__begin, yy->__end);
+  goto l469;
+  l470: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yy->__begin = yy->__pos;
+  if (!yy_ERROR(yy)) goto fail;
+  yy->__end = yy->__pos;
+  yyDo(yy, yy_338_IncBinaryDirect, yy->__begin, yy->__end);
+  l469: ;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_IncDataDirect(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  int s2_p, s2_t;
+  int s3_p, s3_t;
+  if (!yymatchString(yy, "\151\156\143\144\141\164\141")) goto fail;
+  if (!yy_SPC(yy)) goto fail;
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_IncFileName(yy)) goto l476;
+  if (!yy_SPC(yy)) goto l476;
+  s2_p = yy->__pos; s2_t = yy->__thunkpos;
+  if (!yymatchChar(yy, 44)) goto l478;
+  if (!yy_SPC(yy)) goto l478;
+  if (!yy_IncFileOffset(yy)) goto l478;
+  s3_p = yy->__pos; s3_t = yy->__thunkpos;
+  if (!yymatchChar(yy, 44)) goto l480;
+  if (!yy_SPC(yy)) goto l480;
+  if (!yy_IncFileLength(yy)) goto l480;
+  goto l479;
+  l480: yy->__pos = s3_p; yy->__thunkpos = s3_t;
+  l479: ;
+  goto l477;
+  l478: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  l477: ;
+  yyDo(yy, yy_339_IncDataDirect, yy->__begin, yy->__end);
+  goto l475;
+  l476: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yy->__begin = yy->__pos;
+  if (!yy_ERROR(yy)) goto fail;
+  yy->__end = yy->__pos;
+  yyDo(yy, yy_340_IncDataDirect, yy->__begin, yy->__end);
+  l475: ;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_IncFileName(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  int s2_p, s2_t;
+  int s3_p, s3_t;
+  if (!yymatchChar(yy, 34)) goto fail;
+  yy->__begin = yy->__pos;
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yymatchChar(yy, 34)) goto l481;
+  goto fail;
+  l481: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yymatchDot(yy)) goto fail;
+  l482: s2_p = yy->__pos; s2_t = yy->__thunkpos;
+  s3_p = yy->__pos; s3_t = yy->__thunkpos;
+  if (!yymatchChar(yy, 34)) goto l484;
+  goto l483;
+  l484: yy->__pos = s3_p; yy->__thunkpos = s3_t;
+  if (!yymatchDot(yy)) goto l483;
+  goto l482;
+  l483: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  yy->__end = yy->__pos;
+  if (!yymatchChar(yy, 34)) goto fail;
+  yyDo(yy, yy_341_IncFileName, yy->__begin, yy->__end);
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_IncFileOffset(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_HexNumber(yy)) goto l486;
+  yyDo(yy, yy_342_IncFileOffset, yy->__begin, yy->__end);
+  goto l485;
+  l486: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_IntNumber(yy)) goto fail;
+  yyDo(yy, yy_343_IncFileOffset, yy->__begin, yy->__end);
+  l485: ;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_IncFileLength(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_HexNumber(yy)) goto l488;
+  yyDo(yy, yy_344_IncFileLength, yy->__begin, yy->__end);
+  goto l487;
+  l488: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_IntNumber(yy)) goto fail;
+  yyDo(yy, yy_345_IncFileLength, yy->__begin, yy->__end);
+  l487: ;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_DefineVariable(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  if (!yymatchString(yy, "\144\145\146\151\156\145")) goto fail;
+  if (!yy_SPC(yy)) goto fail;
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_DefineNumeric(yy)) goto l490;
+  goto l489;
+  l490: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_DefineString(yy)) goto l491;
+  goto l489;
+  l491: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yy->__begin = yy->__pos;
+  if (!yy_ERROR(yy)) goto fail;
+  yy->__end = yy->__pos;
+  yyDo(yy, yy_346_DefineVariable, yy->__begin, yy->__end);
+  l489: ;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_DefineNumeric(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  if (!yy_NumDefName(yy)) goto fail;
+  if (!yy_SPC(yy)) goto fail;
+  if (!yymatchChar(yy, 61)) goto fail;
+  yyDo(yy, yy_347_DefineNumeric, yy->__begin, yy->__end);
+  if (!yy_SPC(yy)) goto fail;
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_DecNumber(yy)) goto l493;
+  yyDo(yy, yy_348_DefineNumeric, yy->__begin, yy->__end);
+  goto l492;
+  l493: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_HexNumber(yy)) goto l494;
+  yyDo(yy, yy_349_DefineNumeric, yy->__begin, yy->__end);
+  goto l492;
+  l494: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yy->__begin = yy->__pos;
+  if (!yy_ERROR(yy)) goto fail;
+  yy->__end = yy->__pos;
+  yyDo(yy, yy_350_DefineNumeric, yy->__begin, yy->__end);
+  l492: ;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_DefineString(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  if (!yy_StrDefName(yy)) goto fail;
+  if (!yy_SPC(yy)) goto fail;
+  if (!yymatchChar(yy, 61)) goto fail;
+  yyDo(yy, yy_351_DefineString, yy->__begin, yy->__end);
+  if (!yy_SPC(yy)) goto fail;
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yy_ConstString(yy)) goto l496;
+  yyDo(yy, yy_352_DefineString, yy->__begin, yy->__end);
+  goto l495;
+  l496: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yy_ExtendedString(yy)) goto l497;
+  yyDo(yy, yy_353_DefineString, yy->__begin, yy->__end);
+  goto l495;
+  l497: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yy->__begin = yy->__pos;
+  if (!yy_ERROR(yy)) goto fail;
+  yy->__end = yy->__pos;
+  yyDo(yy, yy_354_DefineString, yy->__begin, yy->__end);
+  l495: ;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_NumDefName(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yy->__begin = yy->__pos;
+  if (!yy_Identifier(yy)) goto fail;
+  yy->__end = yy->__pos;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_StrDefName(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  int s2_p, s2_t;
+  yy->__begin = yy->__pos;
+  if (!yy_Identifier(yy)) goto fail;
+  yy->__end = yy->__pos;
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yymatchChar(yy, 36)) goto l499;
+  goto l498;
+  l499: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  s2_p = yy->__pos; s2_t = yy->__thunkpos;
+  if (!yymatchChar(yy, 36)) goto l500;
+  goto fail;
+  l500: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  yyDo(yy, yy_355_StrDefName, yy->__begin, yy->__end);
+  l498: ;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_OptionsDirective(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  if (!yymatchString(yy, "\157\160\164\151\157\156\163")) goto fail;
+  if (!yy_SPC(yy)) goto fail;
+  if (!yy_OptionList(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_OptionList(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  int s2_p, s2_t;
+  if (!yy_ParserOption(yy)) goto fail;
+  l501: s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  s2_p = yy->__pos; s2_t = yy->__thunkpos;
+  if (!yymatchChar(yy, 44)) goto l504;
+  if (!yy_SPC(yy)) goto l504;
+  if (!yy_ParserOption(yy)) goto l504;
+  goto l503;
+  l504: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  yy->__begin = yy->__pos;
+  if (!yy_ERROREXP(yy)) goto l502;
+  yy->__end = yy->__pos;
+  yyDo(yy, yy_356_OptionList, yy->__begin, yy->__end);
+  l503: ;
+  goto l501;
+  l502: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_ParserOption(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  int s2_p, s2_t;
+  int s3_p, s3_t;
+  int s4_p, s4_t;
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yymatchString(yy, "\155\157\144\145")) goto l506;
+  if (!yy_SPC(yy)) goto l506;
+  s2_p = yy->__pos; s2_t = yy->__thunkpos;
+  if (!yymatchChar(yy, 61)) goto l508;
+  if (!yy_SPC(yy)) goto l508;
+  if (!yy_ParserOptionMode(yy)) goto l508;
+  goto l507;
+  l508: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  yy->__begin = yy->__pos;
+  if (!yy_ERROREXP(yy)) goto l506;
+  yy->__end = yy->__pos;
+  yyDo(yy, yy_357_ParserOption, yy->__begin, yy->__end);
+  l507: ;
+  goto l505;
+  l506: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yymatchString(yy, "\157\160\164\151\155\151\172\145")) goto l509;
+  if (!yy_SPC(yy)) goto l509;
+  if (!yymatchChar(yy, 61)) goto l509;
+  if (!yy_SPC(yy)) goto l509;
+  if (!yy_OptimizeSuboptions(yy)) goto l509;
+  goto l505;
+  l509: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yy->__begin = yy->__pos;
+  s3_p = yy->__pos; s3_t = yy->__thunkpos;
+  s4_p = yy->__pos; s4_t = yy->__thunkpos;
+  if (!yymatchChar(yy, 45)) goto l514;
+  goto l513;
+  l514: yy->__pos = s4_p; yy->__thunkpos = s4_t;
+  if (!yymatchChar(yy, 43)) goto l512;
+  l513: ;
+  goto l511;
+  l512: yy->__pos = s3_p; yy->__thunkpos = s3_t;
+  l511: ;
+  yy->__end = yy->__pos;
+  if (!yymatchString(yy, "\157\160\164\151\155\151\172\145")) goto l510;
+  if (!yy_SPC(yy)) goto l510;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( parser_set_optimize(yytext[0] != '-') , 1 )) goto l510;
+#undef yytext
+#undef yyleng
+  }
+  goto l505;
+  l510: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yy->__begin = yy->__pos;
+  if (!yy_ERROREXP(yy)) goto fail;
+  yy->__end = yy->__pos;
+  yyDo(yy, yy_358_ParserOption, yy->__begin, yy->__end);
+  l505: ;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_ParserOptionMode(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yymatchString(yy, "\144\145\146\141\165\154\164")) goto l516;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( parser_set_mode(parser_mode_default), 1 )) goto l516;
+#undef yytext
+#undef yyleng
+  }
+  goto l515;
+  l516: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yymatchString(yy, "\143\157\155\160\141\164\151\142\154\145")) goto l517;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( parser_set_mode(parser_mode_compatible), 1 )) goto l517;
+#undef yytext
+#undef yyleng
+  }
+  goto l515;
+  l517: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yymatchString(yy, "\145\170\164\145\156\144\145\144")) goto l518;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( parser_set_mode(parser_mode_extended), 1 )) goto l518;
+#undef yytext
+#undef yyleng
+  }
+  goto l515;
+  l518: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  yy->__begin = yy->__pos;
+  if (!yy_ERROREXP(yy)) goto fail;
+  yy->__end = yy->__pos;
+  yyDo(yy, yy_359_ParserOptionMode, yy->__begin, yy->__end);
+  l515: ;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_OptimizeSuboptions(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  int s1_p, s1_t;
+  int s2_p, s2_t;
+  int s3_p, s3_t;
+  int s4_p, s4_t;
+  int s5_p, s5_t;
+  int s6_p, s6_t;
+  int s7_p, s7_t;
+  yy->__begin = yy->__pos;
+  s1_p = yy->__pos; s1_t = yy->__thunkpos;
+  if (!yymatchChar(yy, 43)) goto l520;
+  goto l519;
+  l520: yy->__pos = s1_p; yy->__thunkpos = s1_t;
+  if (!yymatchChar(yy, 45)) goto fail;
+  l519: ;
+  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\000\000\376\377\377\207\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto fail;
+  l521: s2_p = yy->__pos; s2_t = yy->__thunkpos;
+  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\207\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l522;
+  goto l521;
+  l522: yy->__pos = s2_p; yy->__thunkpos = s2_t;
+  yy->__end = yy->__pos;
+  s3_p = yy->__pos; s3_t = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( parser_add_optimize_str( yytext + 1, yytext[0] == '+' ) )) goto l524;
+#undef yytext
+#undef yyleng
+  }
+  goto l523;
+  l524: yy->__pos = s3_p; yy->__thunkpos = s3_t;
+  yyDo(yy, yy_360_OptimizeSuboptions, yy->__begin, yy->__end);
+  l523: ;
+  l525: s4_p = yy->__pos; s4_t = yy->__thunkpos;
+  yy->__begin = yy->__pos;
+  s5_p = yy->__pos; s5_t = yy->__thunkpos;
+  if (!yymatchChar(yy, 43)) goto l528;
+  goto l527;
+  l528: yy->__pos = s5_p; yy->__thunkpos = s5_t;
+  if (!yymatchChar(yy, 45)) goto l526;
+  l527: ;
+  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\000\000\376\377\377\207\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l526;
+  l529: s6_p = yy->__pos; s6_t = yy->__thunkpos;
+  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\207\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l530;
+  goto l529;
+  l530: yy->__pos = s6_p; yy->__thunkpos = s6_t;
+  yy->__end = yy->__pos;
+  s7_p = yy->__pos; s7_t = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( parser_add_optimize_str( yytext + 1, yytext[0] == '+' ) )) goto l532;
+#undef yytext
+#undef yyleng
+  }
+  goto l531;
+  l532: yy->__pos = s7_p; yy->__thunkpos = s7_t;
+  yyDo(yy, yy_361_OptimizeSuboptions, yy->__begin, yy->__end);
+  l531: ;
+  goto l525;
+  l526: yy->__pos = s4_p; yy->__thunkpos = s4_t;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_REM(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_REM ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_DATA(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_DATA ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_INPUT(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_INPUT ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_COLOR(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_COLOR ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_LIST(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_LIST ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_ENTER(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_ENTER ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_LET(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_LET ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_IF(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_IF ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_FOR(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_FOR ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_NEXT(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_NEXT ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_GOTO(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_GOTO ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_GO_TO(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_GO_TO ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_GOSUB(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_GOSUB ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_TRAP(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_TRAP ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_BYE(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_BYE ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_CONT(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_CONT ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_COM(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_COM ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_CLOSE(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_CLOSE ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_CLR(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_CLR ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_DEG(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_DEG ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_DIM(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_DIM ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_END(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_END ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_NEW(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_NEW ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_OPEN(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_OPEN ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_LOAD(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_LOAD ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_SAVE(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_SAVE ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_STATUS(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_STATUS ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_NOTE(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_NOTE ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_POINT(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_POINT ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_XIO(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_XIO ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_ON(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_ON ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_POKE(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_POKE ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_PRINT(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_PRINT ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_RAD(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_RAD ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_READ(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_READ ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_RESTORE(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_RESTORE ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_RETURN(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_RETURN ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_RUN(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_RUN ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_STOP(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_STOP ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_POP(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_POP ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_PRINT_(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_PRINT_ ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_GET(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_GET ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_PUT(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_PUT ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_GRAPHICS(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_GRAPHICS ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_PLOT(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_PLOT ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_POSITION(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_POSITION ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_DOS(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_DOS ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_DRAWTO(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_DRAWTO ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_SETCOLOR(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_SETCOLOR ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_LOCATE(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_LOCATE ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_SOUND(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_SOUND ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_LPRINT(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_LPRINT ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_CSAVE(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_CSAVE ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_CLOAD(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_CLOAD ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_BAS_ERROR(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_BAS_ERROR ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_DPOKE(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_DPOKE ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_MOVE(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_MOVE ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_N_MOVE(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_N_MOVE ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_F_F(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_F_F ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_REPEAT(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_REPEAT ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_UNTIL(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_UNTIL ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_WHILE(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_WHILE ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_WEND(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_WEND ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_ELSE(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_ELSE ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_ENDIF(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_ENDIF ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_BPUT(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_BPUT ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_BGET(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_BGET ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_FILLTO(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_FILLTO ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_DO(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_DO ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_LOOP(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_LOOP ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_EXIT(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_EXIT ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_DIR(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_DIR ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_LOCK(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_LOCK ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_UNLOCK(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_UNLOCK ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_RENAME(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_RENAME ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_DELETE(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_DELETE ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_PAUSE(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_PAUSE ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_TIME_S(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_TIME_S ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_PROC(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_PROC ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_EXEC(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_EXEC ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_ENDPROC(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_ENDPROC ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_FCOLOR(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_FCOLOR ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_F_L(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_F_L ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_REM_(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 0, STMT_REM_ ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_RENUM(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_RENUM ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_DEL(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_DEL ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_DUMP(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_DUMP ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_TRACE(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_TRACE ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_TEXT(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_TEXT ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_BLOAD(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_BLOAD ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_BRUN(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_BRUN ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_GO_S(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_GO_S ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_LBL_S(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_LBL_S ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_F_B(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_F_B ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_PAINT(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_PAINT ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_CLS(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_CLS ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_DSOUND(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_DSOUND ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_CIRCLE(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_CIRCLE ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_P_PUT(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_P_PUT ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_P_GET(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testStatement( 1, STMT_P_GET ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_ON_GOTO(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 0, TOK_ON_GOTO ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_ON_GOSUB(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 0, TOK_ON_GOSUB ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_FOR_TO(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 0, TOK_FOR_TO ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_STEP(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 0, TOK_STEP ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_THEN(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 0, TOK_THEN ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_NOT(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 0, TOK_NOT ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_OR(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 0, TOK_OR ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_AND(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 0, TOK_AND ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_STRP(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 0, TOK_STRP ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_CHRP(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 0, TOK_CHRP ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_USR(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 0, TOK_USR ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_ASC(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 0, TOK_ASC ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_VAL(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 0, TOK_VAL ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_LEN(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 0, TOK_LEN ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_ADR(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 0, TOK_ADR ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_ATN(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 0, TOK_ATN ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_COS(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 0, TOK_COS ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_PEEK(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 0, TOK_PEEK ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_SIN(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 0, TOK_SIN ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_RND(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 0, TOK_RND ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_FRE(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 0, TOK_FRE ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_EXP(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 0, TOK_EXP ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_LOG(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 0, TOK_LOG ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_CLOG(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 0, TOK_CLOG ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_SQR(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 0, TOK_SQR ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_SGN(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 0, TOK_SGN ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_ABS(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 0, TOK_ABS ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_INT(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 0, TOK_INT ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_PADDLE(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 0, TOK_PADDLE ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_STICK(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 0, TOK_STICK ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_PTRIG(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 0, TOK_PTRIG ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_STRIG(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 0, TOK_STRIG ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_DPEEK(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 1, TOK_DPEEK ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_INSTR(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 1, TOK_INSTR ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_INKEYP(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 1, TOK_INKEYP ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_EXOR(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 1, TOK_EXOR ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_HEXP(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 1, TOK_HEXP ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_DEC(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 1, TOK_DEC ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_DIV(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 1, TOK_DIV ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_FRAC(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 1, TOK_FRAC ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_TIMEP(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 1, TOK_TIMEP ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_TIME(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 1, TOK_TIME ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_MOD(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 1, TOK_MOD ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_ON_EXEC(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 1, TOK_ON_EXEC ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_RND_S(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 1, TOK_RND_S ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_RAND(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 1, TOK_RAND ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_TRUNC(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 1, TOK_TRUNC ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_ON_GOSHARP(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 1, TOK_ON_GOSHARP ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_UINSTR(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 1, TOK_UINSTR ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_ERR(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 1, TOK_ERR ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+YY_RULE(int) yy_ERL(yycontext *yy)
+{
+  int yypos0 = yy->__pos, yythunkpos0 = yy->__thunkpos;
+  yyText(yy, yy->__begin, yy->__end);
+  {
+#define yytext yy->__text
+#define yyleng yy->__textlen
+  if (!( testToken( 1, TOK_ERL ) )) goto fail;
+#undef yytext
+#undef yyleng
+  }
+  if (!yy_SPC(yy)) goto fail;
+  return 1;
+  fail: yy->__pos = yypos0; yy->__thunkpos = yythunkpos0;
+  return 0;
+}
+
+YY_PARSE(int) yyparsefrom(int (*yystart)(yycontext *yy))
+{
+  int yyok;
+  yycontext *yy = yyctx;
+  if (!yy->__buflen)
+  {
+    yy->__buflen = 1024;
+    yy->__buf = (char *)malloc(yy->__buflen);
+    yy->__textlen = 1024;
+    yy->__text = (char *)malloc(yy->__textlen);
+    yy->__thunkslen = 32;
+    yy->__thunks = (yythunk *)malloc(sizeof(yythunk) * yy->__thunkslen);
+    yy->__valslen = 32;
+    yy->__vals = (YYSTYPE *)malloc(sizeof(YYSTYPE) * yy->__valslen);
+    yy->__begin = yy->__end = yy->__pos = yy->__limit = yy->__thunkpos = 0;
+  }
+  yy->__begin = yy->__end = yy->__pos;
+  yy->__thunkpos = 0;
+  yy->__val = yy->__vals;
+  yyok = yystart(yy);
+  if (yyok) yyDone(yy);
+  yyCommit(yy);
+  return yyok;
+}
+
+YY_PARSE(int) yyparse(void)
+{
+  return yyparsefrom(yy_Program);
+}
+
+YY_PARSE(void) yyrelease(yycontext *yy)
+{
+  if (yy->__buflen)
+  {
+    yy->__buflen = 0;
+    free(yy->__buf);
+    free(yy->__text);
+    free(yy->__thunks);
+    free(yy->__vals);
+  }
+  memset(yy, 0, sizeof(*yy));
+}
+
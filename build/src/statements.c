@@ -0,0 +1,114 @@
+/* This file is auto-generated from peg/statements.txt, don't modify */
+#include "statements.h"
+const struct statements statements[109] = {
+    { "REM",      0, "."     },
+    { "DATA",     1, "D."    },
+    { "INPUT",    1, "I."    },
+    { "COLOR",    1, "C."    },
+    { "LIST",     1, "L."    },
+    { "ENTER",    1, "E."    },
+    { "LET",      2, "LET"   },
+    { "IF",       2, "IF"    },
+    { "FOR",      1, "F."    },
+    { "NEXT",     1, "N."    },
+    { "GOTO",     1, "G."    },
+    { "GO TO",    1, "G."    },
+    { "GOSUB",    3, "GOS."  },
+    { "TRAP",     1, "T."    },
+    { "BYE",      1, "B."    },
+    { "CONT",     3, "CONT"  },
+    { "COM",      3, "COM"   },
+    { "CLOSE",    2, "CL."   },
+    { "CLR",      3, "CLR"   },
+    { "DEG",      2, "DEG"   },
+    { "DIM",      2, "DIM"   },
+    { "END",      3, "END"   },
+    { "NEW",      3, "NEW"   },
+    { "OPEN",     1, "O."    },
+    { "LOAD",     2, "LO."   },
+    { "SAVE",     1, "S."    },
+    { "STATUS",   2, "ST."   },
+    { "NOTE",     2, "NO."   },
+    { "POINT",    1, "P."    },
+    { "XIO",      1, "X."    },
+    { "ON",       2, "ON"    },
+    { "POKE",     3, "POKE"  },
+    { "PRINT",    2, "PR."   },
+    { "RAD",      2, "RAD"   },
+    { "READ",     3, "READ"  },
+    { "RESTORE",  3, "RES."  },
+    { "RETURN",   3, "RET."  },
+    { "RUN",      2, "RUN"   },
+    { "STOP",     3, "STOP"  },
+    { "POP",      3, "POP"   },
+    { "?",        1, "?"     },
+    { "GET",      2, "GET"   },
+    { "PUT",      2, "PUT"   },
+    { "GRAPHICS", 2, "GR."   },
+    { "PLOT",     2, "PL."   },
+    { "POSITION", 3, "POS."  },
+    { "DOS",      2, "DOS"   },
+    { "DRAWTO",   2, "DR."   },
+    { "SETCOLOR", 2, "SE."   },
+    { "LOCATE",   3, "LOC."  },
+    { "SOUND",    2, "SO."   },
+    { "LPRINT",   2, "LP."   },
+    { "CSAVE",    2, "CS."   },
+    { "CLOAD",    4, "CLOAD" },
+    { "",         0, ""      },
+    { "ERROR -",  7, "ERROR -" },
+    { "DPOKE",    2, "DP."   },
+    { "MOVE",     1, "M."    },
+    { "-MOVE",    1, "-."    },
+    { "*F",       1, "*F"    },
+    { "REPEAT",   3, "REP."  },
+    { "UNTIL",    1, "U."    },
+    { "WHILE",    1, "W."    },
+    { "WEND",     2, "WE."   },
+    { "ELSE",     2, "EL."   },
+    { "ENDIF",    3, "END."  },
+    { "BPUT",     2, "BP."   },
+    { "BGET",     2, "BG."   },
+    { "FILLTO",   2, "FI."   },
+    { "DO",       2, "DO"    },
+    { "LOOP",     3, "LOOP"  },
+    { "EXIT",     2, "EX."   },
+    { "DIR",      3, "DIR"   },
+    { "LOCK",     4, "LOCK"  },
+    { "UNLOCK",   3, "UNL."  },
+    { "RENAME",   3, "REN."  },
+    { "DELETE",   3, "DEL."  },
+    { "PAUSE",    2, "PA."   },
+    { "TIME$=",   2, "TI."   },
+    { "PROC",     3, "PROC"  },
+    { "EXEC",     3, "EXEC"  },
+    { "ENDPROC",  4, "ENDP." },
+    { "FCOLOR",   2, "FC."   },
+    { "*L",       2, "*L"    },
+    { "--",       2, "--"    },
+    { "RENUM",    4, "RENUM" },
+    { "DEL",      3, "DEL"   },
+    { "DUMP",     2, "DU."   },
+    { "TRACE",    4, "TRACE" },
+    { "TEXT",     2, "TE."   },
+    { "BLOAD",    2, "BL."   },
+    { "BRUN",     2, "BR."   },
+    { "GO#",      3, "GO#"   },
+    { "#",        1, "#"     },
+    { "*B",       2, "*B"    },
+    { "PAINT",    3, "PAI."  },
+    { "CLS",      3, "CLS"   },
+    { "DSOUND",   2, "DS."   },
+    { "CIRCLE",   2, "CI."   },
+    { "%PUT",     1, "%."    },
+    { "%GET",     2, "%G."   },
+    { "",         0, ""      },
+    { "IF",       2, "IF"    },
+    { "IF",       2, "IF"    },
+    { "IF",       2, "IF"    },
+    { "PROC",     0, ""      },
+    { "EXEC",     0, ""      },
+    { "",         0, ""      },
+    { "", 0, "" }
+};
+
@@ -0,0 +1,120 @@
+#pragma once
+/* This file is auto-generated from peg/statements.txt, don't modify */
+
+enum enum_statements {
+    STMT_REM,
+    STMT_DATA,
+    STMT_INPUT,
+    STMT_COLOR,
+    STMT_LIST,
+    STMT_ENTER,
+    STMT_LET,
+    STMT_IF,
+    STMT_FOR,
+    STMT_NEXT,
+    STMT_GOTO,
+    STMT_GO_TO,
+    STMT_GOSUB,
+    STMT_TRAP,
+    STMT_BYE,
+    STMT_CONT,
+    STMT_COM,
+    STMT_CLOSE,
+    STMT_CLR,
+    STMT_DEG,
+    STMT_DIM,
+    STMT_END,
+    STMT_NEW,
+    STMT_OPEN,
+    STMT_LOAD,
+    STMT_SAVE,
+    STMT_STATUS,
+    STMT_NOTE,
+    STMT_POINT,
+    STMT_XIO,
+    STMT_ON,
+    STMT_POKE,
+    STMT_PRINT,
+    STMT_RAD,
+    STMT_READ,
+    STMT_RESTORE,
+    STMT_RETURN,
+    STMT_RUN,
+    STMT_STOP,
+    STMT_POP,
+    STMT_PRINT_,
+    STMT_GET,
+    STMT_PUT,
+    STMT_GRAPHICS,
+    STMT_PLOT,
+    STMT_POSITION,
+    STMT_DOS,
+    STMT_DRAWTO,
+    STMT_SETCOLOR,
+    STMT_LOCATE,
+    STMT_SOUND,
+    STMT_LPRINT,
+    STMT_CSAVE,
+    STMT_CLOAD,
+    STMT_LET_INV,
+    STMT_BAS_ERROR,
+    STMT_DPOKE,
+    STMT_MOVE,
+    STMT_N_MOVE,
+    STMT_F_F,
+    STMT_REPEAT,
+    STMT_UNTIL,
+    STMT_WHILE,
+    STMT_WEND,
+    STMT_ELSE,
+    STMT_ENDIF,
+    STMT_BPUT,
+    STMT_BGET,
+    STMT_FILLTO,
+    STMT_DO,
+    STMT_LOOP,
+    STMT_EXIT,
+    STMT_DIR,
+    STMT_LOCK,
+    STMT_UNLOCK,
+    STMT_RENAME,
+    STMT_DELETE,
+    STMT_PAUSE,
+    STMT_TIME_S,
+    STMT_PROC,
+    STMT_EXEC,
+    STMT_ENDPROC,
+    STMT_FCOLOR,
+    STMT_F_L,
+    STMT_REM_,
+    STMT_RENUM,
+    STMT_DEL,
+    STMT_DUMP,
+    STMT_TRACE,
+    STMT_TEXT,
+    STMT_BLOAD,
+    STMT_BRUN,
+    STMT_GO_S,
+    STMT_LBL_S,
+    STMT_F_B,
+    STMT_PAINT,
+    STMT_CLS,
+    STMT_DSOUND,
+    STMT_CIRCLE,
+    STMT_P_PUT,
+    STMT_P_GET,
+    STMT_ENDIF_INVISIBLE,
+    STMT_IF_MULTILINE,
+    STMT_IF_THEN,
+    STMT_IF_NUMBER,
+    STMT_PROC_VAR,
+    STMT_EXEC_PAR,
+    STMT_REM_HIDDEN,
+};
+
+struct statements {
+    const char *stm_long;
+    int min;
+    const char *stm_short;
+};
+extern const struct statements statements[109];
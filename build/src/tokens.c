@@ -0,0 +1,100 @@
+/* This file is auto-generated from peg/tokens.txt, don't modify */
+#include "tokens.h"
+const struct tokens tokens[95] = {
+    { "",         ""      },
+    { "",         ""      },
+    { ",",        ", "    },
+    { "",         ""      },
+    { "",         ""      },
+    { ";",        "; "    },
+    { "",         ""      },
+    { "GOTO",     " goto " },
+    { "GOSUB",    " gosub " },
+    { "TO",       " to "  },
+    { "STEP",     " step " },
+    { "THEN",     " then " },
+    { "#",        "#"     },
+    { "<=",       " <= "  },
+    { "<>",       " <> "  },
+    { ">=",       " >= "  },
+    { "<",        " < "   },
+    { ">",        " > "   },
+    { "=",        " = "   },
+    { "^",        " ^ "   },
+    { "*",        " * "   },
+    { "+",        " + "   },
+    { "-",        " - "   },
+    { "/",        " / "   },
+    { "NOT",      "not "  },
+    { "OR",       " or "  },
+    { "AND",      " and " },
+    { "(",        "( "    },
+    { ")",        " )"    },
+    { "=",        " = "   },
+    { "=",        " = "   },
+    { "<=",       " <= "  },
+    { "<>",       " <> "  },
+    { ">=",       " >= "  },
+    { "<",        " < "   },
+    { ">",        " > "   },
+    { "=",        " = "   },
+    { "+",        "+"     },
+    { "-",        "-"     },
+    { "(",        "( "    },
+    { "",         ""      },
+    { "",         ""      },
+    { "(",        "( "    },
+    { "(",        "( "    },
+    { ",",        ", "    },
+    { "STR$",     "str$"  },
+    { "CHR$",     "chr$"  },
+    { "USR",      "usr"   },
+    { "ASC",      "asc"   },
+    { "VAL",      "val"   },
+    { "LEN",      "len"   },
+    { "ADR",      "adr"   },
+    { "ATN",      "atn"   },
+    { "COS",      "cos"   },
+    { "PEEK",     "peek"  },
+    { "SIN",      "sin"   },
+    { "RND",      "rnd"   },
+    { "FRE",      "fre"   },
+    { "EXP",      "exp"   },
+    { "LOG",      "log"   },
+    { "CLOG",     "clog"  },
+    { "SQR",      "sqr"   },
+    { "SGN",      "sgn"   },
+    { "ABS",      "abs"   },
+    { "INT",      "int"   },
+    { "PADDLE",   "paddle" },
+    { "STICK",    "stick" },
+    { "PTRIG",    "ptrig" },
+    { "STRIG",    "strig" },
+    { "DPEEK",    "dpeek" },
+    { "&",        " & "   },
+    { "!",        " ! "   },
+    { "INSTR",    "instr" },
+    { "INKEY$",   "inkey$" },
+    { "EXOR",     " exor " },
+    { "HEX$",     "hex$"  },
+    { "DEC",      "dec"   },
+    { "DIV",      " div " },
+    { "FRAC",     "frac"  },
+    { "TIME$",    "time$" },
+    { "TIME",     "time"  },
+    { "MOD",      " mod " },
+    { "EXEC",     " exec " },
+    { "RND",      "rnd"   },
+    { "RAND",     "rand"  },
+    { "TRUNC",    "trunc" },
+    { "%0",       "%0"    },
+    { "%1",       "%1"    },
+    { "%2",       "%2"    },
+    { "%3",       "%3"    },
+    { "GO#",      " go# " },
+    { "UINSTR",   "uinstr" },
+    { "ERR",      "err"   },
+    { "ERL",      "erl"   },
+    { 0, "" }
+};
+
@@ -0,0 +1,106 @@
+#pragma once
+/* This file is auto-generated from peg/tokens.txt, don't modify */
+
+enum enum_tokens {
+    TOK_QUOTE,
+    TOK_DUMMY,
+    TOK_COMMA,
+    TOK_DOLAR,
+    TOK_COLON,
+    TOK_SEMICOLON,
+    TOK_EOL,
+    TOK_ON_GOTO,
+    TOK_ON_GOSUB,
+    TOK_FOR_TO,
+    TOK_STEP,
+    TOK_THEN,
+    TOK_SHARP,
+    TOK_N_LEQ,
+    TOK_N_NEQ,
+    TOK_N_GEQ,
+    TOK_N_LE,
+    TOK_N_GE,
+    TOK_N_EQ,
+    TOK_CARET,
+    TOK_STAR,
+    TOK_PLUS,
+    TOK_MINUS,
+    TOK_SLASH,
+    TOK_NOT,
+    TOK_OR,
+    TOK_AND,
+    TOK_L_PRN,
+    TOK_R_PRN,
+    TOK_F_ASGN,
+    TOK_S_ASGN,
+    TOK_S_LEQ,
+    TOK_S_NEQ,
+    TOK_S_GEQ,
+    TOK_S_LE,
+    TOK_S_GE,
+    TOK_S_EQ,
+    TOK_UPLUS,
+    TOK_UMINUS,
+    TOK_S_L_PRN,
+    TOK_A_L_PRN,
+    TOK_D_L_PRN,
+    TOK_FN_PRN,
+    TOK_DS_L_PRN,
+    TOK_A_COMMA,
+    TOK_STRP,
+    TOK_CHRP,
+    TOK_USR,
+    TOK_ASC,
+    TOK_VAL,
+    TOK_LEN,
+    TOK_ADR,
+    TOK_ATN,
+    TOK_COS,
+    TOK_PEEK,
+    TOK_SIN,
+    TOK_RND,
+    TOK_FRE,
+    TOK_EXP,
+    TOK_LOG,
+    TOK_CLOG,
+    TOK_SQR,
+    TOK_SGN,
+    TOK_ABS,
+    TOK_INT,
+    TOK_PADDLE,
+    TOK_STICK,
+    TOK_PTRIG,
+    TOK_STRIG,
+    TOK_DPEEK,
+    TOK_ANDPER,
+    TOK_EXCLAM,
+    TOK_INSTR,
+    TOK_INKEYP,
+    TOK_EXOR,
+    TOK_HEXP,
+    TOK_DEC,
+    TOK_DIV,
+    TOK_FRAC,
+    TOK_TIMEP,
+    TOK_TIME,
+    TOK_MOD,
+    TOK_ON_EXEC,
+    TOK_RND_S,
+    TOK_RAND,
+    TOK_TRUNC,
+    TOK_PER_0,
+    TOK_PER_1,
+    TOK_PER_2,
+    TOK_PER_3,
+    TOK_ON_GOSHARP,
+    TOK_UINSTR,
+    TOK_ERR,
+    TOK_ERL,
+    TOK_LAST_TOKEN
+};
+
+struct tokens {
+    const char *tok_short;
+    const char *tok_long;
+};
+extern const struct tokens tokens[95];
@@ -0,0 +1,26 @@
+#!/bin/bash
+#
+# Benchmark of the constant replacement optimization
+# --------------------------------------------------
+#
+# Generates a program with 20000 numeric literals, written as POKE
+# statements that fill a big lookup table, and measures the time needed
+# to parse and optimize it.
+#
+# Usage: samples/bench-const.sh [path/to/basicParser]
+
+parser=${1:-build/basicParser}
+prog=${TMPDIR:-/tmp}/bench-const.txt
+
+awk 'BEGIN {
+    for(l = 0; l < 2000; l++) {
+        printf "%d ", 10 * (l + 1);
+        for(i = 0; i < 5; i++) {
+            n = l * 5 + i;
+            printf "%sPOKE %d,%d", (i ? ":" : ""), 20000 + n, (n * 7919) % 256;
+        }
+        printf "\n";
+    }
+}' > "$prog"
+
+time "$parser" -O -l "$prog" -o "${prog%.txt}.lst"
@@ -109,7 +109,7 @@ static int expr_get_bas_rec(string_buf *out, expr *e)
     }
     if( e->rgt )
     {
-        if( use_r_parens == 0 && e->rgt->type == et_tok && prec >= tok_prec_level(e->rgt->tok) && prec > 0 )
+        if( use_r_parens == 0 && expr_rgt_parens(e) )
         {
             use_r_parens = 1;
             sb_put(out, 0x10 + TOK_L_PRN);
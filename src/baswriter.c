@@ -301,6 +301,13 @@ int bas_write_program(FILE *f, program *pgm, int variables, unsigned max_line_le
             }
             sb_delete(sb);
             // Total length = tokens + 3 (line number + length)
+            //
+            // Splitting at the last possible point gives the minimum number
+            // of lines (and bytes, as each line adds 3 bytes): any part of a
+            // valid line is also a valid line, because the length limits
+            // apply to the end of each statement and labels only force a
+            // line start, so no other packing can fit more statements in the
+            // first lines.
             if( sb_len(bin_line) + 3 > maxlen ||
                     (expr_is_label(ex) && last_split > 0) )
             {
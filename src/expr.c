@@ -99,6 +99,29 @@ expr *expr_new_tok(expr_mngr *mngr, enum enum_tokens tk)
     return n;
 }
 
+// Returns a deep copy of the expression, following both branches
+expr *expr_copy(expr_mngr *mngr, const expr *ex)
+{
+    if( !ex )
+        return 0;
+    expr *n = expr_new(mngr);
+    n->type = ex->type;
+    n->file_line = ex->file_line;
+    n->num = ex->num;
+    n->var = ex->var;
+    n->tok = ex->tok;
+    n->stmt = ex->stmt;
+    if( ex->str )
+    {
+        n->str = dmalloc(ex->slen ? ex->slen : 1);
+        n->slen = ex->slen;
+        memcpy(n->str, ex->str, ex->slen);
+    }
+    n->lft = expr_copy(mngr, ex->lft);
+    n->rgt = expr_copy(mngr, ex->rgt);
+    return n;
+}
+
 expr *expr_new_var_num(expr_mngr *mngr, int vn)
 {
     expr *n = expr_new(mngr);
@@ -214,15 +237,15 @@ int tok_prec_level(enum enum_tokens tk)
         case TOK_AND:
             return 3;
 
+        case TOK_NOT:
+            return 4;
+
         case TOK_N_LEQ:
         case TOK_N_NEQ:
         case TOK_N_GEQ:
         case TOK_N_LE:
         case TOK_N_GE:
         case TOK_N_EQ:
-            return 4;
-
-        case TOK_NOT:
             return 5;
 
         case TOK_PLUS:
@@ -368,6 +391,38 @@ int tok_need_parens(enum enum_tokens tk)
     }
 }
 
+// Check if the right operand of this expression needs parenthesis, when
+// not already added by the token
+int expr_rgt_parens(const expr *e)
+{
+    const expr *r = e->rgt;
+    if( e->type != et_tok || !r || r->type != et_tok )
+        return 0;
+    int prec = tok_prec_level(e->tok);
+    int rprec = tok_prec_level(r->tok);
+    if( prec <= 0 || prec < rprec )
+        return 0;
+    // Prefix operators can be nested without parenthesis, as "NOT NOT X"
+    if( !e->lft && !r->lft && prec == rprec )
+        return 0;
+    // Operators that give the same result in any order, as "A AND B AND C"
+    if( e->tok == r->tok && r->lft )
+    {
+        switch( e->tok )
+        {
+            case TOK_OR:
+            case TOK_AND:
+            case TOK_ANDPER:
+            case TOK_EXCLAM:
+            case TOK_EXOR:
+                return 0;
+            default:
+                break;
+        }
+    }
+    return 1;
+}
+
 const char *expr_get_file_name(const expr *e)
 {
     return expr_mngr_get_file_name(e->mngr);
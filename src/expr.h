@@ -75,6 +75,7 @@ expr *expr_new_var_array(expr_mngr *, int vn);
 expr *expr_new_def_num(expr_mngr *, int dn);
 expr *expr_new_def_str(expr_mngr *, int dn);
 expr *expr_new_label(expr_mngr *, int vn);
+expr *expr_copy(expr_mngr *, const expr *ex);
 int expr_to_program(expr *e, program *out);
 
 int expr_is_label(const expr *e);
@@ -84,6 +85,7 @@ program *expr_get_program(const expr *e);
 int expr_get_file_line(const expr *e);
 int tok_prec_level(enum enum_tokens tk);
 int tok_need_parens(enum enum_tokens tk);
+int expr_rgt_parens(const expr *e);
 
 // Expression Manager manages the "expr" tree, allowing to free all memory
 expr_mngr *expr_mngr_new(program *pgm);
@@ -22,6 +22,9 @@
 #include "program.h"
 #include "sbuf.h"
 #include "dbg.h"
+#include "darray.h"
+#include "dmem.h"
+#include <assert.h>
 #include <string.h>
 #include <stdlib.h>
 
@@ -85,8 +88,6 @@ struct ls {
     int user_num;
     // We added a ':' at the end
     int last_colon;
-    // Tokenized length
-    int tok_len;
     // Original file name
     const char *fname;
     // Original file line
@@ -95,6 +96,21 @@ struct ls {
     FILE *f;
 };
 
+// Returns the number of characters needed to write a line number, we can
+// use scientific notation for line numbers.
+static int ls_num_len(int num)
+{
+    if( num > 9999 && 0 == num % 10000 )
+        return 3;
+    else if( num > 999 && 0 == num % 1000 )
+        return num > 9999 ? 4 : 3;
+    else
+        return num > 9999 ? 5 :
+               num >  999 ? 4 :
+               num >   99 ? 3 :
+               num >    9 ? 2 : 1;
+}
+
 static int ls_set_linenum(struct ls *ls, int num)
 {
     if( num < ls->cur_line )
@@ -104,28 +120,15 @@ static int ls_set_linenum(struct ls *ls, int num)
         return 1;
     }
     ls->cur_line = num;
-    // We can use scientific notation for line numbers
-    if( num > 9999 && 0 == num % 10000 )
-        ls->num_len = 3;
-    else if( num > 999 && 0 == num % 1000 )
-        ls->num_len = num > 9999 ? 4 : 3;
-    else
-        ls->num_len  = num > 9999 ? 5 :
-                       num >  999 ? 4 :
-                       num >   99 ? 3 :
-                       num >    9 ? 2 : 1;
+    ls->num_len = ls_num_len(num);
     return 0;
 }
 
-static void ls_write_line(struct ls *ls, int len, int tok_len)
+static void ls_write_line(struct ls *ls)
 {
-    if( len < 0 )
-    {
-        // Full line
-        len = sb_len(ls->out);
-        if( len && ls->last_colon )
-            len --;
-    }
+    int len = sb_len(ls->out);
+    if( len && ls->last_colon )
+        len --;
     if( ! len && !ls->user_num )
         return;
 
@@ -150,16 +153,173 @@ static void ls_write_line(struct ls *ls, int len, int tok_len)
     fputc(0x9b, ls->f);
 
     // Delete from buffer and unset line number
-    if( sb_len(ls->out) - len > 1 )
-        sb_erase(ls->out, 0, len + 1);
-    else
-        sb_clear(ls->out);
+    sb_clear(ls->out);
     ls_set_linenum(ls, ls->cur_line + 1);
     ls->user_num = 0;
     ls->last_colon = 0;
-    ls->tok_len -= tok_len;
-    if( ls->tok_len < 0 )
-        ls->tok_len = 0;
+}
+
+// A statement waiting to be written, statements are accumulated until the
+// next line number or forced line break and then packed into lines.
+struct ls_stmt {
+    string_buf *sb;  // Short listing, including the ':' at the end
+    int colon;       // The listing ends with ':'
+    int tok_len;     // Tokenized length
+    int maxlen;      // Maximum tokenized line length including this statement
+    int split;       // The line can be split after this statement
+    int label;       // The statement must be at the start of a line
+    int file_line;   // Original file line
+};
+
+typedef darray(struct ls_stmt) ls_stmt_list;
+
+// Number of extra lines over the minimum tried at each statement. Placing
+// statements in a later line changes the line number length (as "1E4" is
+// shorter than "9999"), so an unsplittable part could fit only there.
+#define LS_SLACK 3
+
+// Line packing state at the start of each statement
+struct ls_state {
+    int min_line;                   // Minimum lines needed, -1 if not reachable
+    int ok[LS_SLACK+1];             // Reachable with "min_line + i" lines
+    int over[LS_SLACK+1];           // Number of lines over the limits
+    int prev[LS_SLACK+1];           // First statement in the last line
+    int prev_i[LS_SLACK+1];         // State index at that statement
+};
+
+// Adds a way to reach the state with "lines" lines
+static void ls_state_add(struct ls_state *st, int lines, int over, int prev, int prev_i)
+{
+    if( st->min_line < 0 || lines < st->min_line )
+    {
+        // Shift the current states to keep the minimum at index 0
+        int d = st->min_line < 0 ? LS_SLACK + 1 : st->min_line - lines;
+        for(int i=LS_SLACK; i>=0; i--)
+        {
+            if( i >= d )
+            {
+                st->ok[i] = st->ok[i-d];
+                st->over[i] = st->over[i-d];
+                st->prev[i] = st->prev[i-d];
+                st->prev_i[i] = st->prev_i[i-d];
+            }
+            else
+                st->ok[i] = 0;
+        }
+        st->min_line = lines;
+    }
+    int i = lines - st->min_line;
+    if( i > LS_SLACK )
+        return;
+    // On ties, use the last start, so the first lines are the fullest
+    if( !st->ok[i] || over <= st->over[i] )
+    {
+        st->ok[i] = 1;
+        st->over[i] = over;
+        st->prev[i] = prev;
+        st->prev_i[i] = prev_i;
+    }
+}
+
+// Writes the accumulated statements, using the minimum number of lines that
+// fit both the character and the tokenized length limits.
+static int ls_write_stmts(struct ls *ls, ls_stmt_list *sl, int max_line_len)
+{
+    int n = darray_len(sl), err = 0;
+    if( !n )
+    {
+        ls_write_line(ls);
+        return 0;
+    }
+
+    // Search all possible lines starting at each reachable statement
+    struct ls_state *st = dmalloc(sizeof(struct ls_state) * (n + 1));
+    for(int i=0; i<=n; i++)
+        st[i].min_line = -1;
+    ls_state_add(&st[0], 0, 0, -1, 0);
+    for(int i=0; i<n; i++)
+    {
+        if( st[i].min_line < 0 )
+            continue;
+        for(int s=0; s<=LS_SLACK; s++)
+        {
+            if( !st[i].ok[s] )
+                continue;
+            int line = st[i].min_line + s;
+            int chars = ls_num_len(ls->cur_line + line), tok_len = 0;
+            int over = 0, first = 1;
+            for(int j=i; j<n; j++)
+            {
+                const struct ls_stmt *p = &darray_i(sl, j);
+                if( j > i && p->label )
+                    break;
+                chars += sb_len(p->sb);
+                tok_len += p->tok_len;
+                // Check: tokens + 3 (line number (2) + length) > max line len.
+                if( chars - p->colon > max_line_len || tok_len + 3 > p->maxlen )
+                    over = 1;
+                // Once over the limits, only the first split is accepted,
+                // so that we always have a result.
+                if( over && !first )
+                    break;
+                if( p->split || j + 1 == n )
+                {
+                    ls_state_add(&st[j+1], line + 1, st[i].over[s] + over, i, s);
+                    first = 0;
+                }
+            }
+        }
+    }
+
+    // Select the best result, with the fewest lines over the limits
+    int best = -1;
+    for(int s=0; s<=LS_SLACK; s++)
+        if( st[n].ok[s] && (best < 0 || st[n].over[s] < st[n].over[best]) )
+            best = s;
+    assert(best >= 0);
+
+    // Get the start of each line, from the end
+    int nlines = st[n].min_line + best;
+    int *start = dmalloc(sizeof(int) * (nlines + 1));
+    start[nlines] = n;
+    for(int l=nlines, i=n, s=best; l>0; l--)
+    {
+        int pi = st[i].prev[s], ps = st[i].prev_i[s];
+        start[l-1] = pi;
+        i = pi;
+        s = ps;
+    }
+
+    // Write all lines
+    for(int l=0; l<nlines; l++)
+    {
+        int tok_len = 0;
+        for(int j=start[l]; j<start[l+1]; j++)
+        {
+            const struct ls_stmt *p = &darray_i(sl, j);
+            sb_cat(ls->out, p->sb);
+            tok_len += p->tok_len;
+            ls->last_colon = p->colon;
+            ls->file_line = p->file_line;
+        }
+        if( sb_len(ls->out) - ls->last_colon + ls->num_len > max_line_len ||
+            tok_len + 3 > darray_i(sl, start[l+1] - 1).maxlen )
+        {
+            err_print(ls->fname, ls->file_line,
+                      "can't split line %d to shorter size (current len %d chars, %d bytes)\n",
+                      ls->cur_line, sb_len(ls->out) - ls->last_colon, tok_len);
+            err = 1;
+        }
+        ls_write_line(ls);
+    }
+
+    free(start);
+    free(st);
+    struct ls_stmt *p;
+    darray_foreach(p, sl)
+        sb_delete(p->sb);
+    sl->len = 0;
+    return err;
 }
 
 int lister_list_program_short(FILE *f, program *pgm, unsigned max_line_len)
@@ -168,7 +328,6 @@ int lister_list_program_short(FILE *f, program *pgm, unsigned max_line_len)
     ls.max_len = ls.max_num = ls.num_lines = 0;
     ls.out = sb_new();
     ls.num_len = 0;
-    ls.tok_len = 0;
     ls.f = f;
     ls.cur_line = -1;
     ls.last_colon = 0;
@@ -176,8 +335,8 @@ int lister_list_program_short(FILE *f, program *pgm, unsigned max_line_len)
     ls.fname = pgm_get_file_name(pgm);
     ls.file_line = 0;
     int no_split = 0;
-    int last_split = 0, last_tok_len = 0;
     int return_error = 0;
+    ls_stmt_list *sl = darray_new(struct ls_stmt, 64);
 
     // For each line/statement:
     for(const expr *ex = pgm_get_expr(pgm); ex != 0 ; ex = ex->lft)
@@ -200,55 +359,39 @@ int lister_list_program_short(FILE *f, program *pgm, unsigned max_line_len)
                 if( !skip_colon )
                     sb_put(sb, ':');
 
-                ls.file_line = ex->file_line;
                 // Get tokenized length
                 unsigned bas_len = expr_get_bas_len(ex);
                 unsigned maxlen = expr_get_bas_maxlen(ex);
                 if( bas_len + 4 >= maxlen )
                 {
                     string_buf *prn = expr_print_alone(ex);
-                    err_print(ls.fname, ls.file_line, "statement too long at line %d:\n", ls.cur_line);
-                    err_print(ls.fname, ls.file_line, "'%.*s'\n", sb_len(prn), sb_data(prn));
+                    err_print(ls.fname, ex->file_line, "statement too long at line %d:\n", ls.cur_line);
+                    err_print(ls.fname, ex->file_line, "'%.*s'\n", sb_len(prn), sb_data(prn));
                     sb_delete(prn);
                     return_error = 1;
                 }
 
-                // Split before a label (write full curren line)
-                if( expr_is_label(ex) && sb_len(ls.out) )
-                    ls_write_line(&ls, -1, ls.tok_len);
-                // See if line is too big to join with last line
-                else if( ((ls.tok_len + 4 + bas_len) > maxlen) ||
-                         ((sb_len(ls.out) + ls.num_len - !skip_colon + sb_len(sb)) > max_line_len) )
-                {
-                    if( !last_split )
-                    {
-                        err_print(ls.fname, ls.file_line,
-                                  "can't split line %d to shorter size (current len %d chars, %d bytes)\n",
-                                  ls.cur_line, sb_len(ls.out) + sb_len(sb), ls.tok_len + 1 + bas_len);
-                        return_error = 1;
-                    }
-                    else
-                    {
-                        ls_write_line(&ls, last_split, last_tok_len);
-                        last_split = 0;
-                    }
-                }
-                // Add statement
-                sb_cat(ls.out, sb);
-                ls.tok_len += 1 + bas_len;
-                ls.last_colon = !skip_colon;
-                if( !no_split )
-                {
-                    last_split = sb_len(ls.out) - ls.last_colon;
-                    last_tok_len = ls.tok_len;
-                }
+                struct ls_stmt st;
+                st.sb = sb;
+                st.colon = !skip_colon;
+                st.tok_len = 1 + bas_len;
+                st.maxlen = maxlen;
+                st.split = !no_split;
+                st.label = expr_is_label(ex);
+                st.file_line = ex->file_line;
+                // Split before a label
+                if( st.label && darray_len(sl) )
+                    darray_i(sl, darray_len(sl) - 1).split = 1;
+                darray_add(sl, st);
             }
-            sb_delete(sb);
+            else
+                sb_delete(sb);
         }
         else
         {
-            // A line break, (full) output current line
-            ls_write_line(&ls, -1, ls.tok_len);
+            // A line break, output all pending statements
+            if( ls_write_stmts(&ls, sl, max_line_len) )
+                return_error = 1;
             // Update file line
             ls.file_line = ex->file_line;
             // Get new line number
@@ -259,15 +402,14 @@ int lister_list_program_short(FILE *f, program *pgm, unsigned max_line_len)
                     return_error = 1;
                 ls.user_num = 1;
             }
-            // Set split point to current position
-            last_split = sb_len(ls.out);
-            last_tok_len = ls.tok_len;
         }
     }
     // Output last line
-    if( sb_len(ls.out) || ls.user_num )
-        ls_write_line(&ls, -1, ls.tok_len);
+    if( darray_len(sl) || ls.user_num )
+        if( ls_write_stmts(&ls, sl, max_line_len) )
+            return_error = 1;
 
+    darray_free(sl);
     sb_delete(ls.out);
     // Output summary info
     if( do_debug )
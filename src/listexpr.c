@@ -369,7 +369,7 @@ static int print_expr_long_rec(string_buf *out, const expr *e, int skip_then)
     }
     if( e->rgt )
     {
-        if( use_r_parens == 0 && e->rgt->type == et_tok && prec >= tok_prec_level(e->rgt->tok) && prec > 0 )
+        if( use_r_parens == 0 && expr_rgt_parens(e) )
         {
             use_r_parens = 1;
             sb_puts(out, "( ");
@@ -547,7 +547,7 @@ static int print_expr_short_rec(string_buf *out, const expr *e)
     }
     if( e->rgt )
     {
-        if( use_r_parens == 0 && e->rgt->type == et_tok && prec >= tok_prec_level(e->rgt->tok) && prec > 0 )
+        if( use_r_parens == 0 && expr_rgt_parens(e) )
         {
             use_r_parens = 1;
             sb_put(out, '(');
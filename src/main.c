@@ -26,6 +26,8 @@
 #include "version.h"
 #include "optimize.h"
 #include "convertbas.h"
+#include "profile.h"
+#include "remarks.h"
 #include <string.h>
 #include <unistd.h>
 #include <stdlib.h>
@@ -145,9 +147,10 @@ int main(int argc, char **argv)
     int max_bin_len = 255;
     int bin_variables = 0;
     int keep_comments = 0;
+    const char *profile_file = 0;
     enum parser_dialect parser_dialect = parser_dialect_turbo;
 
-    while ((opt = getopt(argc, argv, "hkaAbvsqlco:n:fxO")) != -1)
+    while ((opt = getopt(argc, argv, "hkaAbvsqlco:n:fxOr:p:")) != -1)
     {
         switch (opt)
         {
@@ -236,6 +239,16 @@ int main(int argc, char **argv)
             case 'n':
                 max_opt_len = atoi(optarg);
                 break;
+            case 'p':
+                profile_file = optarg;
+                break;
+            case 'r':
+                if( !remarks_open(optarg) )
+                {
+                    fprintf(stderr, "%s: can't open remarks file '%s': %s\n", argv[0], optarg, strerror(errno));
+                    exit(EXIT_FAILURE);
+                }
+                break;
             case 'h':
                 print_header();
                 fprintf(stderr, "Usage: %s [options] filename\n"
@@ -256,6 +269,9 @@ int main(int argc, char **argv)
                                 "\t-O  Optimize the parsed program. An optional argument with '+' or '-'\n"
                                 "\t    enables/disables specific optimization. Use -O help for a list of\n"
                                 "\t    all available options.\n"
+                                "\t-p  Reads the execution profile of the program from the given file,\n"
+                                "\t    used to guide the optimizations.\n"
+                                "\t-r  Writes optimization remarks to the given file, as JSON lines.\n"
                                 "\t-h  Shows help and exit.\n",
                         argv[0], max_line_len, max_bin_len);
                 exit(EXIT_FAILURE);
@@ -328,6 +344,16 @@ int main(int argc, char **argv)
         parser_set_dialect(parser_dialect);
         int ok = parse_file(inFname);
 
+        // Load the profile before any transformation
+        if( ok && profile_file )
+        {
+            profile *prof = profile_load(profile_file, parse_get_current_pgm());
+            if( prof )
+                pgm_set_profile(parse_get_current_pgm(), prof);
+            else
+                ok = 0;
+        }
+
         // Convert to TurboBasic compatible if output is BAS or short LST
         if( ok && (out_type == out_short || out_type == out_binary) )
             ok = !convert_to_turbobas(parse_get_current_pgm(), keep_comments);
@@ -399,6 +425,7 @@ int main(int argc, char **argv)
     if( output )
         free(output);
 
+    remarks_close();
     return all_ok ? EXIT_SUCCESS : EXIT_FAILURE;
 }
 
@@ -0,0 +1,344 @@
+/*
+ *  Basic Parser - TurboBasic XL compatible parsing and transformation tool.
+ *  Copyright (C) 2015 Daniel Serpell
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "optbool.h"
+#include "expr.h"
+#include "dbg.h"
+#include "optcost.h"
+#include "remarks.h"
+#include "optutil.h"
+#include <string.h>
+
+// Simplifies logical operations and comparisons. In BASIC, comparisons,
+// NOT, AND and OR give 0 or 1, and NOT, AND, OR and the IF, WHILE and
+// UNTIL conditions only test if the value is 0. Those are the "boolean
+// contexts", where any value different from 0 is the same as 1.
+//
+//  - NOT NOT X to X, if X is 0 or 1 or in a boolean context,
+//  - NOT (A<B) to A>=B, and the same for the other comparisons,
+//  - X AND 1 to X and X OR 0 to X, if X is 0 or 1 or in a boolean context,
+//  - X AND 0 to 0 and X OR 1 to 1, if X can't give an error,
+//  - X<>0 to X, if X is 0 or 1 or in a boolean context,
+//  - X=0 to NOT X,
+//  - X=1 to X and X<>1 to NOT X, if X is 0 or 1,
+//  - X AND X to X and X OR X to X, if X is 0 or 1 or in a boolean
+//    context, and (X AND Y) AND X to X AND Y.
+
+typedef struct {
+    int count;  // Number of replacements
+} bl_ctx;
+
+static int expr_is_cnum(const expr *ex)
+{
+    return ex && (ex->type == et_c_number || ex->type == et_c_hexnumber);
+}
+
+static int is_compare(enum enum_tokens tok)
+{
+    switch( tok )
+    {
+        case TOK_N_LEQ:
+        case TOK_N_NEQ:
+        case TOK_N_GEQ:
+        case TOK_N_LE:
+        case TOK_N_GE:
+        case TOK_N_EQ:
+        case TOK_S_LEQ:
+        case TOK_S_NEQ:
+        case TOK_S_GEQ:
+        case TOK_S_LE:
+        case TOK_S_GE:
+        case TOK_S_EQ:
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+// Returns the comparison with the opposite result
+static enum enum_tokens negate_compare(enum enum_tokens tok)
+{
+    switch( tok )
+    {
+        case TOK_N_LEQ: return TOK_N_GE;
+        case TOK_N_NEQ: return TOK_N_EQ;
+        case TOK_N_GEQ: return TOK_N_LE;
+        case TOK_N_LE:  return TOK_N_GEQ;
+        case TOK_N_GE:  return TOK_N_LEQ;
+        case TOK_N_EQ:  return TOK_N_NEQ;
+        case TOK_S_LEQ: return TOK_S_GE;
+        case TOK_S_NEQ: return TOK_S_EQ;
+        case TOK_S_GEQ: return TOK_S_LE;
+        case TOK_S_LE:  return TOK_S_GEQ;
+        case TOK_S_GE:  return TOK_S_LEQ;
+        case TOK_S_EQ:  return TOK_S_NEQ;
+        default:        return tok;
+    }
+}
+
+// Returns true if the expression value is always 0 or 1
+static int is_bool(expr *ex)
+{
+    ex = opt_strip_prn(ex);
+    if( !ex )
+        return 0;
+    if( expr_is_cnum(ex) )
+        return ex->num == 0 || ex->num == 1;
+    if( ex->type != et_tok )
+        return 0;
+    return is_compare(ex->tok) || ex->tok == TOK_NOT || ex->tok == TOK_AND || ex->tok == TOK_OR;
+}
+
+// Returns true if the expression has side effects or gives a different
+// value each time, so it can't be evaluated a different number of times.
+static int has_side_effects(const expr *ex)
+{
+    if( !ex )
+        return 0;
+    if( ex->type == et_tok && (ex->tok == TOK_USR || ex->tok == TOK_RND ||
+                               ex->tok == TOK_RAND || ex->tok == TOK_INKEYP) )
+        return 1;
+    return has_side_effects(ex->lft) || has_side_effects(ex->rgt);
+}
+
+// Returns true if the expression can be removed: it has no side effects
+// and can't give an error. Arithmetic can overflow, so only variables and
+// constants joined with the logical operators and comparisons are safe.
+static int is_safe(const expr *ex)
+{
+    if( !ex )
+        return 1;
+    switch( ex->type )
+    {
+        case et_c_number:
+        case et_c_hexnumber:
+        case et_c_string:
+        case et_var_number:
+        case et_var_string:
+            return 1;
+        case et_tok:
+            if( !is_compare(ex->tok) )
+            {
+                switch( ex->tok )
+                {
+                    case TOK_L_PRN:
+                    case TOK_UMINUS:
+                    case TOK_UPLUS:
+                    case TOK_NOT:
+                    case TOK_AND:
+                    case TOK_OR:
+                        break;
+                    default:
+                        return 0;
+                }
+            }
+            return is_safe(ex->lft) && is_safe(ex->rgt);
+        default:
+            return 0;
+    }
+}
+
+static void set_expr(expr *ex, const expr *ne)
+{
+    memcpy(ex, ne, sizeof(*ex));
+}
+
+static void set_number(expr *ex, double x)
+{
+    ex->type = et_c_number;
+    ex->num = x;
+    ex->lft = 0;
+    ex->rgt = 0;
+}
+
+static void set_not(expr *ex, expr *x)
+{
+    ex->type = et_tok;
+    ex->tok = TOK_NOT;
+    ex->lft = 0;
+    ex->rgt = x;
+}
+
+// Applies one rule to the node, returns a description of the rule or NULL
+static const char *apply_rule(expr *ex, int ctx)
+{
+    if( ex->type != et_tok )
+        return 0;
+
+    expr *l = opt_strip_prn(ex->lft), *r = opt_strip_prn(ex->rgt);
+    switch( ex->tok )
+    {
+        case TOK_NOT:
+            if( !r || r->type != et_tok )
+                return 0;
+            if( r->tok == TOK_NOT && (ctx || is_bool(r->rgt)) )
+            {
+                set_expr(ex, opt_strip_prn(r->rgt));
+                return "NOT NOT X with X";
+            }
+            if( is_compare(r->tok) )
+            {
+                set_expr(ex, r);
+                ex->tok = negate_compare(r->tok);
+                return "NOT of a comparison with the opposite comparison";
+            }
+            return 0;
+
+        case TOK_AND:
+        case TOK_OR:
+        {
+            int is_and = ex->tok == TOK_AND;
+            for(int i = 0; i < 2; i++)
+            {
+                expr *k = i ? l : r, *x = i ? r : l;
+                if( !expr_is_cnum(k) )
+                    continue;
+                // X AND 1 and X OR 0
+                if( (k->num != 0) == is_and && (ctx || is_bool(x)) )
+                {
+                    set_expr(ex, x);
+                    return is_and ? "X AND 1 with X" : "X OR 0 with X";
+                }
+                // X AND 0 and X OR 1
+                if( (k->num != 0) != is_and && is_safe(x) )
+                {
+                    set_number(ex, is_and ? 0 : 1);
+                    return is_and ? "X AND 0 with 0" : "X OR 1 with 1";
+                }
+            }
+            if( opt_expr_equal(l, r) && !has_side_effects(l) && (ctx || is_bool(l)) )
+            {
+                set_expr(ex, l);
+                return "repeated condition";
+            }
+            // (X AND Y) AND X and X AND (X AND Y)
+            for(int i = 0; i < 2; i++)
+            {
+                expr *a = i ? r : l, *b = i ? l : r;
+                if( a && a->type == et_tok && a->tok == ex->tok && !has_side_effects(b) &&
+                    (opt_expr_equal(a->lft, b) || opt_expr_equal(a->rgt, b)) )
+                {
+                    set_expr(ex, a);
+                    return "repeated condition";
+                }
+            }
+            return 0;
+        }
+
+        case TOK_N_EQ:
+        case TOK_N_NEQ:
+        {
+            int eq = ex->tok == TOK_N_EQ;
+            expr *k = r, *x = l;
+            if( expr_is_cnum(l) )
+            {
+                k = l;
+                x = r;
+            }
+            if( !expr_is_cnum(k) || expr_is_cnum(x) )
+                return 0;
+            if( k->num == 0 && eq )
+            {
+                set_not(ex, x);
+                return "X=0 with NOT X";
+            }
+            if( k->num == 0 && (ctx || is_bool(x)) )
+            {
+                set_expr(ex, x);
+                return "X<>0 with X";
+            }
+            if( k->num == 1 && is_bool(x) )
+            {
+                if( eq )
+                    set_expr(ex, x);
+                else
+                    set_not(ex, x);
+                return eq ? "X=1 with X" : "X<>1 with NOT X";
+            }
+            return 0;
+        }
+
+        default:
+            return 0;
+    }
+}
+
+// Simplifies the expression, "ctx" is true in a boolean context.
+static void simplify(bl_ctx *c, expr *ex, int ctx)
+{
+    if( !ex )
+        return;
+
+    int sub = 0;
+    if( ex->type == et_tok )
+    {
+        if( ex->tok == TOK_NOT || ex->tok == TOK_AND || ex->tok == TOK_OR )
+            sub = 1;
+        else if( ex->tok == TOK_L_PRN )
+            sub = ctx;
+    }
+    simplify(c, ex->lft, sub);
+    simplify(c, ex->rgt, sub);
+
+    int bytes = opt_cost_expr_bytes(ex), time = opt_cost_expr_time(ex);
+    const char *desc = apply_rule(ex, ctx);
+    if( !desc )
+        return;
+
+    info_print(expr_get_file_name(ex), expr_get_file_line(ex), "replacing %s.\n", desc);
+    remark("boolean", expr_get_file_name(ex), expr_get_file_line(ex), remark_applied,
+           bytes - opt_cost_expr_bytes(ex), time - opt_cost_expr_time(ex), "replaced %s", desc);
+    c->count ++;
+    // The result can be simplified again
+    simplify(c, ex, ctx);
+}
+
+int opt_simplify_bool(expr *prog)
+{
+    bl_ctx c;
+    c.count = 0;
+
+    for(expr *ex = prog; ex; ex = ex->lft)
+    {
+        if( ex->type != et_stmt )
+            continue;
+        switch( ex->stmt )
+        {
+            case STMT_IF_THEN:
+            case STMT_IF_NUMBER:
+                if( ex->rgt && ex->rgt->type == et_tok && ex->rgt->tok == TOK_THEN )
+                {
+                    simplify(&c, ex->rgt->lft, 1);
+                    simplify(&c, ex->rgt->rgt, 0);
+                }
+                break;
+            case STMT_IF_MULTILINE:
+            case STMT_WHILE:
+            case STMT_UNTIL:
+                simplify(&c, ex->rgt, 1);
+                break;
+            default:
+                simplify(&c, ex->rgt, 0);
+                break;
+        }
+    }
+
+    if( c.count )
+        info_print(expr_get_file_name(prog), 0, "simplified %d logical operations.\n", c.count);
+    return 0;
+}
@@ -156,7 +156,7 @@ static int do_constprop(expr *ex)
             return x;
         case TOK_NOT:
             if( r_inum )
-                return set_number(ex, 0 != ex->rgt->num);
+                return set_number(ex, 0 == ex->rgt->num);
             return x;
         case TOK_PLUS:
             if( l_inum && r_inum )
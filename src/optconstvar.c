@@ -22,7 +22,10 @@
 #include "dbg.h"
 #include "parser.h"
 #include "program.h"
+#include "optcost.h"
+#include "remarks.h"
 #include "darray.h"
+#include "dmem.h"
 #include "hash.h"
 #include <assert.h>
 #include <stdlib.h>
@@ -37,6 +40,7 @@ typedef struct {
     const uint8_t *str; // String value, NULL if not a string
     unsigned slen;   // String length
     double num;      // Value, valid if str == NULL
+    int max_gain;    // Upper bound of the bytes saved, used in the selection
 } cvalue;
 
 // List of cvalue
@@ -64,191 +68,378 @@ static int cvalue_comp(const cvalue *a, const cvalue *b)
 struct clen {
     double val;
     int bytes;
+    int vid;
+};
+
+// Classes of expressions joining two values, the class "add" needs
+// parenthesis when used inside a multiplication or as the right operand of
+// a subtraction.
+enum { cls_add, cls_mul };
+
+// Operations used to join values
+enum { op_add, op_sub, op_mul, op_div };
+
+static const enum enum_tokens op_tok[4] = { TOK_PLUS, TOK_MINUS, TOK_STAR, TOK_SLASH };
+
+// Best encoding of a value as an operation between two variables, for each
+// class of expression: "[-]A op B"
+struct cpair {
+    double val;
+    unsigned gen;       // Generation, the entry is empty if not current
+    uint8_t cost[2];    // Number of bytes, 0 if not possible
+    uint8_t neg[2];     // Left variable negated
+    uint8_t op[2];      // Operation
+    uint8_t a[2], b[2]; // Variables, index in the list
+};
+
+// Cached number of bytes needed to encode a value
+struct clen_cache {
+    double val;
+    unsigned gen;       // Generation, the entry is empty if not current
+    int bytes;
 };
 
 #define CLEN_CACHE_SIZE (1<<14)
+#define CLEN_MAX_VARS   256
 typedef struct {
     unsigned len;
-    struct clen list[256];
-    struct clen cache[CLEN_CACHE_SIZE];
+    struct clen list[CLEN_MAX_VARS];
+    unsigned cache_gen;
+    struct clen_cache cache[CLEN_CACHE_SIZE];
+    // Index of the variables by value, the position in the list plus one
+    unsigned short index[2 * CLEN_MAX_VARS];
+    // Table of values obtained joining two variables
+    unsigned gen, psize, pused;
+    struct cpair *pairs;
 } clen_list;
 
-// TODO: should not be a static variable!
-clen_list static_clen_list;
+// State of the constant replacement, allocated on each call
+typedef struct {
+    clen_list costs;    // Cost of the values using the assigned variables
+    clen_list emit;     // Cost of the values using the emitted variables
+    int turbo;          // Using TurboBasic XL dialect
+    int binary;         // Writing a binary program
+} cvar_ctx;
+
+static uint32_t clen_hash(double x)
+{
+    // Use the same hash for 0 and -0, as those compare equal
+    if( x == 0 )
+        x = 0;
+    return hash_any(&x, sizeof(double));
+}
 
-static struct clen *clen_cache_get(clen_list *l, double x)
+static struct clen_cache *clen_cache_get(clen_list *l, double x)
 {
-    unsigned pos = hash_any(&x, sizeof(double)) & (CLEN_CACHE_SIZE-1);
+    unsigned pos = clen_hash(x) & (CLEN_CACHE_SIZE-1);
     return &l->cache[pos];
 }
 
+static void clen_cache_clear(clen_list *l)
+{
+    // Increment the generation, only clear the memory on wrap around
+    l->cache_gen ++;
+    if( !l->cache_gen )
+    {
+        memset(l->cache, 0, sizeof(struct clen_cache) * CLEN_CACHE_SIZE);
+        l->cache_gen = 1;
+    }
+}
+
+static int exact_div(double x)
+{
+    return x == 2 || x == 5 || x == 10;
+}
+
+// Returns the index of the variable with the given value, -1 if not found
+static int clen_find(const clen_list *l, double x)
+{
+    unsigned mask = 2 * CLEN_MAX_VARS - 1;
+    for(unsigned pos = clen_hash(x) & mask; l->index[pos]; pos = (pos + 1) & mask)
+        if( l->list[l->index[pos] - 1].val == x )
+            return l->index[pos] - 1;
+    return -1;
+}
+
+// Returns the slot for the pair with the given value, or the empty slot
+// where it should be inserted.
+static struct cpair *cpair_slot(const clen_list *l, double x)
+{
+    unsigned mask = l->psize - 1;
+    unsigned pos = clen_hash(x) & mask;
+    while( l->pairs[pos].gen == l->gen && l->pairs[pos].val != x )
+        pos = (pos + 1) & mask;
+    return &l->pairs[pos];
+}
+
+static const struct cpair *cpair_get(const clen_list *l, double x)
+{
+    if( !l->pused )
+        return 0;
+    const struct cpair *p = cpair_slot(l, x);
+    return p->gen == l->gen ? p : 0;
+}
+
+static void cpair_add(clen_list *l, double x, int cost, int neg, int op, int a, int b)
+{
+    // Keep the table at most half full
+    if( 2 * (l->pused + 1) > l->psize )
+    {
+        struct cpair *old = l->pairs;
+        unsigned osize = l->psize, ogen = l->gen;
+        l->psize = osize ? osize * 2 : 4096;
+        l->pairs = dcalloc(l->psize, sizeof(struct cpair));
+        l->gen = 1;
+        for(unsigned i=0; i<osize; i++)
+            if( old[i].gen == ogen )
+            {
+                struct cpair *p = cpair_slot(l, old[i].val);
+                *p = old[i];
+                p->gen = l->gen;
+            }
+        free(old);
+    }
+    struct cpair *p = cpair_slot(l, x);
+    if( p->gen != l->gen )
+    {
+        memset(p, 0, sizeof(*p));
+        p->val = x;
+        p->gen = l->gen;
+        l->pused ++;
+    }
+    int cls = (op == op_add || op == op_sub) ? cls_add : cls_mul;
+    if( !p->cost[cls] || cost < p->cost[cls] )
+    {
+        p->cost[cls] = cost;
+        p->neg[cls] = neg;
+        p->op[cls] = op;
+        p->a[cls] = a;
+        p->b[cls] = b;
+    }
+}
+
+// Adds all operations between variables "a" and "b" to the pair table
+static void cpair_add_ops(clen_list *l, int a, int b)
+{
+    const struct clen *ca = l->list + a, *cb = l->list + b;
+    // Operations with 0 are never useful
+    if( ca->val == 0 || cb->val == 0 )
+        return;
+    for(int neg = 0; neg < 2; neg++)
+    {
+        int cost = ca->bytes + cb->bytes + 1 + neg;
+        // Any encoding of 7 bytes or more is useless
+        if( cost > 6 )
+            continue;
+        double x = neg ? -ca->val : ca->val, y = cb->val;
+        // "-A+B" is the same as "B-A"
+        if( !neg )
+            cpair_add(l, x + y, cost, neg, op_add, a, b);
+        cpair_add(l, x - y, cost, neg, op_sub, a, b);
+        cpair_add(l, x * y, cost, neg, op_mul, a, b);
+        // Only divide by values that give exact results
+        if( exact_div(y) )
+            cpair_add(l, x / y, cost, neg, op_div, a, b);
+    }
+}
+
+static void clen_list_clear(clen_list *l)
+{
+    l->len = 0;
+    l->pused = 0;
+    l->gen ++;
+    memset(l->index, 0, sizeof(l->index));
+    clen_cache_clear(l);
+}
+
+// Adds a new variable with the given value to the list
+static void clen_list_add(clen_list *l, double val, int vid)
+{
+    if( l->len >= CLEN_MAX_VARS || clen_find(l, val) >= 0 )
+        return;
+
+    int n = l->len++;
+    l->list[n].val = val;
+    l->list[n].vid = vid;
+    l->list[n].bytes = vid > 127 ? 2 : 1;
+
+    unsigned mask = 2 * CLEN_MAX_VARS - 1, pos = clen_hash(val) & mask;
+    while( l->index[pos] )
+        pos = (pos + 1) & mask;
+    l->index[pos] = n + 1;
+
+    // Add operations with all other variables, in both orders
+    for(int i=0; i<=n; i++)
+    {
+        cpair_add_ops(l, i, n);
+        if( i != n )
+            cpair_add_ops(l, n, i);
+    }
+
+    // All cached lengths could be smaller now
+    clen_cache_clear(l);
+}
+
+static void clen_list_free(clen_list *l)
+{
+    free(l->pairs);
+    l->pairs = 0;
+    l->psize = l->pused = 0;
+}
+
 // Builds a list of the number of bytes needed to encode a value
 static void build_clen_list(clen_list *l, cvalue_list *v)
 {
-    // Clear list
-    l->len = 0;
-    memset(l->cache, 0, sizeof(struct clen) * CLEN_CACHE_SIZE);
+    clen_list_clear(l);
 
     // Now, add all variables already defined
-    for(unsigned i=0; i<v->len && l->len < 256; i++)
+    for(unsigned i=0; i<v->len; i++)
     {
         const cvalue *c = v->data + i;
         // Skip strings and variables not already created
         if( c->str || !c->status )
             continue;
-        l->list[l->len].val = c->num;
-        l->list[l->len].bytes = c->vid > 127 ? 2 : 1;
-        struct clen *cl = clen_cache_get(l, c->num);
-        *cl = l->list[l->len];
-        l->len++;
+        clen_list_add(l, c->num, c->vid);
     }
 }
 
-static int exact_div(double x)
-{
-    return x == 2 || x == 5 || x == 10;
-}
+// Encoding of a value as an expression of the variables in the list
+enum cenc_kind {
+    enc_num,   // Number
+    enc_var,   // Variable:     A
+    enc_neg,   // Negation:    -A
+    enc_not,   // NOT:          NOT A
+    enc_pair,  // Pair:         [-]A op B
+    enc_left,  // Pair left:    P op [-]A
+    enc_right  // Pair right:   [-]A - P
+};
+
+struct cenc {
+    enum cenc_kind kind;
+    int var;     // Variable index
+    int neg;     // Variable is negated
+    int op;      // Operation with the pair
+    int cls;     // Class of the pair
+    double pval; // Value of the pair
+};
 
-static int get_clen_raw(const clen_list *l, double val)
+// Tries to use a pair with value "x", with "extra" bytes added and
+// parenthesis around "add" class if "prn" is set. Updates the best length
+// and the class.
+static int try_pair(const clen_list *l, double x, int extra, int prn, int *best, int *cls)
 {
-    if( !l->len )
-        return 7;
-    // Try to get val using permutations of current variables
-    const struct clen *c1, *c2, *c3;
-    // 0: NOT x
-    if( val == 0 )
-    {
-        for( c1 = l->list; c1 < l->list + l->len; c1++)
-            if( c1->val != 0 && c1->bytes < 5 )
-                return 1 + c1->bytes;
-    }
-    else if( val == 1 )
-    {
-        for( c1 = l->list; c1 < l->list + l->len; c1++)
-            if( c1->val == 0 && c1->bytes < 5 )
-                return 1 + c1->bytes;
-    }
-    // 1: negated variables
-    for( c1 = l->list; c1 < l->list + l->len; c1++)
-        if( c1->val != 0 && c1->bytes < 5 )
-            if( val == -c1->val )
-                return 1 + c1->bytes;
-    // 2: Operations on 2 values
-    for( c1 = l->list; c1 < l->list + l->len; c1++)
-    {
-        if( c1->val == 0 || c1->bytes > 4 )
+    const struct cpair *p = cpair_get(l, x);
+    int found = 0;
+    if( !p )
+        return 0;
+    for(int k=0; k<2; k++)
+    {
+        if( !p->cost[k] )
             continue;
-        for( c2 = l->list; c2 <= c1; c2++)
+        int n = p->cost[k] + extra + ( (k == cls_add && prn) ? 2 : 0 );
+        if( n < *best )
         {
-            int n = c1->bytes + c2->bytes + 1;
-            double x = c1->val, y = c2->val;
-            if( y == 0 || n > 6 )
-                continue;
-            if( val ==  x + y || val == x - y || val == y - x || val == x * y )
-                return n;
-            if( exact_div(y) && val ==  x / y )
-                return n;
-            if( exact_div(x) && val ==  y / x )
-                return n;
+            *best = n;
+            *cls = k;
+            found = 1;
         }
     }
-    // 3: Operations on 2 values with "-" first
-    for( c1 = l->list; c1 < l->list + l->len; c1++)
+    return found;
+}
+
+// Search the shortest expression giving the value "val", using up to three
+// variables. Returns the number of bytes, 7 if it is better to use a number.
+static int get_clen_raw(const clen_list *l, double val, struct cenc *e)
+{
+    int best = 7, cls, i;
+    e->kind = enc_num;
+
+    if( !l->len )
+        return best;
+
+    // Value already in a variable
+    if( (i = clen_find(l, val)) >= 0 && l->list[i].bytes < best )
     {
-        if( c1->val == 0 || c1->bytes > 3 )
-            continue;
-        for( c2 = l->list; c2 <= c1; c2++)
-        {
-            int n = c1->bytes + c2->bytes + 2;
-            double x = c1->val, y = c2->val;
-            if( y == 0 || n > 6 )
-                continue;
-            if( val ==  - x - y || val == - x * y )
-                return n;
-            if( exact_div(y) && val ==  - x / y )
-                return n;
-            if( exact_div(x) && val == - y / x )
-                return n;
-        }
+        best = l->list[i].bytes;
+        e->kind = enc_var;
+        e->var = i;
     }
-    // 4: Operations on 3 values
-    for( c1 = l->list; c1 < l->list + l->len; c1++)
+    // Negated variable
+    if( val != 0 && (i = clen_find(l, -val)) >= 0 && 1 + l->list[i].bytes < best )
     {
-        if( c1->val == 0 || c1->bytes > 2 )
-            continue;
-        for( c2 = l->list; c2 <= c1; c2++)
-        {
-            if( c2->val == 0 || (c1->bytes + c2->bytes) > 3 )
-                continue;
-            for( c3 = l->list; c3 <= c2; c3++)
+        best = 1 + l->list[i].bytes;
+        e->kind = enc_neg;
+        e->var = i;
+    }
+    // NOT x, gives 0 from any other value and 1 from 0
+    if( val == 0 || val == 1 )
+        for(i=0; i<(int)l->len; i++)
+            if( (val == 0) == (l->list[i].val != 0) && 1 + l->list[i].bytes < best )
             {
-                int n = c1->bytes + c2->bytes + c3->bytes + 2;
-                double x = c1->val, y = c2->val, z = c3->val;
-                if( z == 0 || n > 6 )
-                    continue;
-                if( val == x + y + z || val == x + y - z || val == x + z - y || val == y + z - x ||
-                    val == x - y - z || val == y - x - z || val == z - x - y || val == x * y * z ||
-                    val == x * y + z || val == x * z + y || val == y * z + x || val == x * y - z ||
-                    val == x * z - y || val == y * z - x || val == x - y * z || val == y - x * z ||
-                    val == z - x * y )
-                    return n;
-                if( exact_div(z) && (val == x + y / z || val == x - y / z || val == y / z - x ||
-                    val == y + x / z || val == y - x / z || val == x / z - y) )
-                    return n;
-                if( exact_div(y) && (val == x + z / y || val == x - z / y || val == z / y - x ||
-                    val == z + x / y || val == z - x / y || val == x / y - z) )
-                    return n;
-                if( exact_div(x) && (val == z + y / x || val == z - y / x || val == y / x - z ||
-                    val == y + z / x || val == y - z / x || val == z / x - y) )
-                    return n;
+                best = 1 + l->list[i].bytes;
+                e->kind = enc_not;
+                e->var = i;
             }
-        }
+    // Operation between two variables
+    if( try_pair(l, val, 0, 0, &best, &cls) )
+    {
+        e->kind = enc_pair;
+        e->cls = cls;
+        e->pval = val;
     }
-#if 1
-    // 5: Operations on 3 values with "-" before
-    for( c1 = l->list; c1 < l->list + l->len; c1++)
+    // Operation between a pair and a variable, the minimum is 5 bytes
+    for(i=0; i<(int)l->len && best > 5; i++)
     {
-        if( c1->val == 0 || c1->bytes > 2 )
+        const struct clen *c = l->list + i;
+        if( c->val == 0 )
             continue;
-        for( c2 = l->list; c2 <= c1; c2++)
+        for(int neg=0; neg<2; neg++)
         {
-            if( c2->val == 0 || (c1->bytes + c2->bytes) > 3 )
+            int cx = c->bytes + neg;
+            double x = neg ? -c->val : c->val, p;
+            // Minimum pair is 3 bytes, plus the operation
+            if( cx + 4 >= best )
                 continue;
-            for( c3 = l->list; c3 <= c2; c3++)
-            {
-                int n = c1->bytes + c2->bytes + c3->bytes + 2;
-                double x = c1->val, y = c2->val, z = c3->val;
-                if( z == 0 || n > 6 )
-                    continue;
-                if( val == - x - y - z || val == - x * y * z || val == - x - y * z ||
-                    val == - y - x * z || val == - z - x * y )
-                    return n;
-                if( exact_div(z) && (val == - x - y / z || val == - y - x / z) )
-                    return n;
-                if( exact_div(y) && (val == - x + z / y || val == - z - x / y) )
-                    return n;
-                if( exact_div(x) && (val == - z + y / x || val == - y - z / x) )
-                    return n;
-            }
+            // P + X
+            p = val - x;
+            if( try_pair(l, p, cx + 1, 0, &best, &cls) )
+                *e = (struct cenc){ enc_left, i, neg, op_add, cls, p };
+            // P - X, "P - -X" is the same as "P + X"
+            p = val + x;
+            if( !neg && try_pair(l, p, cx + 1, 0, &best, &cls) )
+                *e = (struct cenc){ enc_left, i, neg, op_sub, cls, p };
+            // P * X
+            p = val / x;
+            if( p * x == val && try_pair(l, p, cx + 1, 1, &best, &cls) )
+                *e = (struct cenc){ enc_left, i, neg, op_mul, cls, p };
+            // P / X
+            p = val * x;
+            if( !neg && exact_div(x) && p / x == val && try_pair(l, p, cx + 1, 1, &best, &cls) )
+                *e = (struct cenc){ enc_left, i, neg, op_div, cls, p };
+            // X - P
+            p = x - val;
+            if( try_pair(l, p, cx + 1, 1, &best, &cls) )
+                *e = (struct cenc){ enc_right, i, neg, op_sub, cls, p };
         }
     }
-#endif
-    return 7;
+    return best;
 }
 
 static int get_clen(clen_list *l, double val)
 {
-    struct clen *c = clen_cache_get(l, val);
-    if( c->val != val )
+    struct clen_cache *c = clen_cache_get(l, val);
+    if( c->gen != l->cache_gen || c->val != val )
     {
+        struct cenc e;
         c->val = val;
-        c->bytes = get_clen_raw(l, val);
+        c->gen = l->cache_gen;
+        c->bytes = get_clen_raw(l, val, &e);
     }
     return c->bytes;
 }
 
 // Function to estimate the number of bytes saved by factorizing this constant
-static int cvalue_saved_bytes(const cvalue *c)
+static int cvalue_saved_bytes(clen_list *l, const cvalue *c)
 {
     if( c->str )
     {
@@ -265,7 +456,7 @@ static int cvalue_saved_bytes(const cvalue *c)
         //
         // Note that if we convert more than one string, the next converted use
         // 2 less bytes, as the "DIM" is reused.
-        return (21 + get_clen(&static_clen_list, c->slen) + 2 * c->slen) - c->count * (1+c->slen);
+        return (21 + get_clen(l, c->slen) + 2 * c->slen) - c->count * (1+c->slen);
     }
     else
     {
@@ -279,7 +470,9 @@ static int cvalue_saved_bytes(const cvalue *c)
         //
         // Note that when emitting the code, we reuse any already emitted
         // constant value, so the number of bytes could be less.
-        return 13 + get_clen(&static_clen_list, c->num) - c->count * 6;
+        int vc = opt_cost_var_bytes(0);
+        return OPT_COST_VVT_BYTES + OPT_COST_LET_BYTES + vc + get_clen(l, c->num) -
+               c->count * (OPT_COST_NUM_BYTES - vc);
     }
 }
 
@@ -323,31 +516,141 @@ static int cvalue_sort_abs_comp(const void *pa, const void *pb)
         return +1;
 }
 
-// Function to sort constant values based on bytes saved
-static int cvalue_sort_comp(const void *pa, const void *pb)
+// Upper bound of the bytes saved by factorizing the constant, using the
+// shortest possible initialization code (1 byte).
+static int cvalue_max_gain(const cvalue *c, int big_var)
 {
-    // Calculate the number of bytes for "a" and "b"
-    int sa = cvalue_saved_bytes(pa);
-    int sb = cvalue_saved_bytes(pb);
-    if( sa != sb )
-        return sa-sb;
+    int extra = big_var ? c->count : 0;
+    int vc = opt_cost_var_bytes(0);
+    if( c->str )
+        return c->count * (1+c->slen) - (22 + 2 * c->slen) - extra;
     else
-        return cvalue_sort_abs_comp(pa, pb);
+        return c->count * (OPT_COST_NUM_BYTES - vc) -
+               (OPT_COST_VVT_BYTES + OPT_COST_LET_BYTES + vc + 1) - extra;
 }
 
+// Priority queue of constants, ordered by the upper bound of the gain
+typedef darray(unsigned) cvalue_queue;
 
-static cvalue *cvalue_list_find(cvalue_list *l, cvalue *nv)
+// Returns true if element "a" should be extracted before "b"
+static int cvalue_queue_less(const cvalue_list *l, unsigned a, unsigned b)
 {
-    unsigned i;
-    for(i=0; i<l->len; i++)
-        if( 0 == cvalue_comp(nv, l->data + i) )
-            return l->data + i;
-    return 0;
+    int ga = l->data[a].max_gain, gb = l->data[b].max_gain;
+    return ga > gb || (ga == gb && a < b);
+}
+
+static void cvalue_queue_push(cvalue_queue *q, const cvalue_list *l, unsigned n)
+{
+    darray_add(q, n);
+    unsigned i = q->len - 1;
+    while( i && cvalue_queue_less(l, n, q->data[(i-1)/2]) )
+    {
+        q->data[i] = q->data[(i-1)/2];
+        i = (i-1)/2;
+    }
+    q->data[i] = n;
+}
+
+static unsigned cvalue_queue_pop(cvalue_queue *q, const cvalue_list *l)
+{
+    unsigned top = q->data[0], n = q->data[--q->len], i = 0;
+    for(;;)
+    {
+        unsigned c = 2 * i + 1;
+        if( c >= q->len )
+            break;
+        if( c + 1 < q->len && cvalue_queue_less(l, q->data[c+1], q->data[c]) )
+            c++;
+        if( !cvalue_queue_less(l, q->data[c], n) )
+            break;
+        q->data[i] = q->data[c];
+        i = c;
+    }
+    if( q->len )
+        q->data[i] = n;
+    return top;
 }
 
-static void cvalue_list_sort(cvalue_list *l)
+// Fills the queue with all the constants not already replaced that could
+// produce a gain.
+static void cvalue_queue_fill(cvalue_queue *q, cvalue_list *l, int big_var)
 {
-    qsort(l->data, l->len, sizeof(l->data[0]), cvalue_sort_comp);
+    q->len = 0;
+    for(unsigned i=0; i<l->len; i++)
+    {
+        cvalue *cv = l->data + i;
+        cv->max_gain = cvalue_max_gain(cv, big_var);
+        if( !cv->status && cv->max_gain >= 0 )
+            cvalue_queue_push(q, l, i);
+    }
+}
+
+// Hash index of the constant list, used to search repeated values
+typedef struct {
+    unsigned size;  // Number of slots, power of 2
+    unsigned used;  // Number of slots in use
+    unsigned *slot; // Position in the list plus one, 0 if empty
+} cvalue_index;
+
+static uint32_t cvalue_hash(const cvalue *c)
+{
+    if( c->str )
+        return hash_any(c->str, c->slen);
+    // Use the same hash for 0 and -0, as those compare equal
+    double x = c->num == 0 ? 0 : c->num;
+    return hash_any(&x, sizeof(double));
+}
+
+static void cvalue_index_init(cvalue_index *ix, unsigned size)
+{
+    ix->size = size;
+    ix->used = 0;
+    ix->slot = dcalloc(size, sizeof(unsigned));
+}
+
+static void cvalue_index_free(cvalue_index *ix)
+{
+    free(ix->slot);
+    ix->slot = 0;
+}
+
+// Search value in the index, returns the slot with the value or the empty
+// slot where the value should be inserted.
+static unsigned *cvalue_index_slot(cvalue_index *ix, const cvalue_list *l, const cvalue *nv)
+{
+    unsigned mask = ix->size - 1;
+    unsigned pos = cvalue_hash(nv) & mask;
+    while( ix->slot[pos] && cvalue_comp(nv, l->data + ix->slot[pos] - 1) )
+        pos = (pos + 1) & mask;
+    return &ix->slot[pos];
+}
+
+// Adds element "n" of the list to the index
+static void cvalue_index_add(cvalue_index *ix, const cvalue_list *l, unsigned n)
+{
+    // Keep the table at most half full
+    if( 2 * (ix->used + 1) > ix->size )
+    {
+        cvalue_index old = *ix;
+        cvalue_index_init(ix, old.size * 2);
+        for(unsigned i=0; i<old.size; i++)
+            if( old.slot[i] )
+            {
+                *cvalue_index_slot(ix, l, l->data + old.slot[i] - 1) = old.slot[i];
+                ix->used ++;
+            }
+        cvalue_index_free(&old);
+    }
+    *cvalue_index_slot(ix, l, l->data + n) = n + 1;
+    ix->used ++;
+}
+
+static cvalue *cvalue_list_find(cvalue_list *l, cvalue_index *ix, const cvalue *nv)
+{
+    unsigned *s = cvalue_index_slot(ix, l, nv);
+    if( *s )
+        return l->data + *s - 1;
+    return 0;
 }
 
 static void cvalue_list_sort_abs(cvalue_list *l)
@@ -371,7 +674,7 @@ static int expr_is_then_number(const expr *ex)
 }
 
 // Update constant value. Returns current count of constant values found and updates tree
-static int update_cvalue(const expr *ex, cvalue_list *l)
+static int update_cvalue(const expr *ex, cvalue_list *l, cvalue_index *ix)
 {
     cvalue val;
     memset(&val, 0, sizeof(val));
@@ -386,11 +689,11 @@ static int update_cvalue(const expr *ex, cvalue_list *l)
         val.slen = ex->slen;
     }
     else if( ex )
-        return update_cvalue(ex->lft, l) + update_cvalue(ex->rgt, l);
+        return update_cvalue(ex->lft, l, ix) + update_cvalue(ex->rgt, l, ix);
     else
         return 0;
 
-    cvalue *n = cvalue_list_find(l, &val);
+    cvalue *n = cvalue_list_find(l, ix, &val);
     if( n )
     {
         n->count ++;
@@ -401,12 +704,13 @@ static int update_cvalue(const expr *ex, cvalue_list *l)
         // Insert new value with count == 1
         val.count = 1;
         darray_add(l, val);
+        cvalue_index_add(ix, l, l->len - 1);
         return 1;
     }
 }
 
 // Replace constant value with variable. Returns number of times replaced
-static int replace_cvalue(expr *ex, cvalue *cv)
+static int replace_cvalue(expr *ex, cvalue *cv, int binary)
 {
     if( !ex )
         return 0;
@@ -433,12 +737,12 @@ static int replace_cvalue(expr *ex, cvalue *cv)
         else
             return 0;
     }
-    else if( expr_is_then_number(ex) && get_output_type() != out_binary )
+    else if( expr_is_then_number(ex) && !binary )
         // Don't replace the line number, as it is not supported in the
         // Turbo-Basic XL or Atari BASIC parsers.
-        return replace_cvalue(ex->lft, cv);
+        return replace_cvalue(ex->lft, cv, binary);
     else if( ex )
-        return replace_cvalue(ex->lft, cv) + replace_cvalue(ex->rgt, cv);
+        return replace_cvalue(ex->lft, cv, binary) + replace_cvalue(ex->rgt, cv, binary);
     else
         return 0;
 }
@@ -451,133 +755,56 @@ static expr *expr_from_vid(expr_mngr *m, int vid)
         return expr_new_var_num(m, vid);
 }
 
-static expr *create_num(expr_mngr *m, const cvalue_list *l, double n)
+static expr *create_var(expr_mngr *m, const clen_list *l, int var, int neg)
+{
+    expr *ex = expr_from_vid(m, l->list[var].vid);
+    return neg ? expr_new_uni(m, ex, TOK_UMINUS) : ex;
+}
+
+static expr *create_pair(expr_mngr *m, const clen_list *l, double x, int cls)
+{
+    const struct cpair *p = cpair_get(l, x);
+    assert(p && p->cost[cls]);
+    return expr_new_bin(m, create_var(m, l, p->a[cls], p->neg[cls]),
+                        create_var(m, l, p->b[cls], 0), op_tok[p->op[cls]]);
+}
+
+static expr *create_num(expr_mngr *m, const clen_list *l, double n)
 {
     // Creates the optimal numeric initialization expression, using
     // already initialized variable.
-    unsigned vnum = 0;
-    double val[256]; // Max 256 values
-    int vid[256];
-
-    // Create a list of available values - makes the following code faster
-    for(unsigned i=0; i<l->len && vnum < 256; i++)
+    struct cenc e;
+    get_clen_raw(l, n, &e);
+    switch( e.kind )
     {
-        const cvalue *c = l->data + i;
-        // Skip strings and variables not already created
-        if( c->str || c->status < 2 )
-            continue;
-        vid[vnum] = c->vid;
-        val[vnum] = c->num;
-        vnum++;
-    }
-
-    // First, try value already in the table:
-    for(unsigned i=0; i < vnum; i++)
-        if( n == val[i] )
-            return expr_from_vid(m, vid[i]);
-
-    // Special cases for "0" and "1": NOT x
-    if( n == 0 )
-        for(unsigned i=0; i < vnum; i++)
-            if( val[i] != 0 )
-                return expr_new_uni(m, expr_from_vid(m, vid[i]), TOK_NOT);
-    if( n == 1 )
-        for(unsigned i=0; i < vnum; i++)
-            if( val[i] == 0 )
-                return expr_new_uni(m, expr_from_vid(m, vid[i]), TOK_NOT);
-
-    // Now, try with "MINUS" and a value:
-    for(unsigned i=0; i < vnum; i++)
-        if( n == -val[i] )
-            return expr_new_uni(m, expr_from_vid(m, vid[i]), TOK_UMINUS);
-
-    // Now, try with operations between two simple values:
-    for(unsigned i=0; i < vnum; i++)
-        for(unsigned j=0; j < vnum; j++)
-        {
-            double x = val[i], y = val[j];
-            int vi = vid[i], vj = vid[j];
-            if( n == x + y )
-                return expr_new_bin(m, expr_from_vid(m, vi), expr_from_vid(m, vj), TOK_PLUS);
-            if( n == x - y )
-                return expr_new_bin(m, expr_from_vid(m, vi), expr_from_vid(m, vj), TOK_MINUS);
-            if( n == x * y )
-                return expr_new_bin(m, expr_from_vid(m, vi), expr_from_vid(m, vj), TOK_STAR);
-            if( n == x / y )
-                return expr_new_bin(m, expr_from_vid(m, vi), expr_from_vid(m, vj), TOK_SLASH);
-        }
-
-    // Same as before, adding "-":
-    for(unsigned i=0; i < vnum; i++)
-        for(unsigned j=0; j < vnum; j++)
-        {
-            double x = val[i], y = val[j];
-            int vi = vid[i], vj = vid[j];
-            if( n == -x - y )
-                return expr_new_bin(m, expr_new_uni(m, expr_from_vid(m, vi), TOK_UMINUS), expr_from_vid(m, vj), TOK_MINUS);
-            if( n == -x * y )
-                return expr_new_bin(m, expr_new_uni(m, expr_from_vid(m, vi), TOK_UMINUS), expr_from_vid(m, vj), TOK_STAR);
-            if( n == -x / y )
-                return expr_new_bin(m, expr_new_uni(m, expr_from_vid(m, vi), TOK_UMINUS), expr_from_vid(m, vj), TOK_SLASH);
-        }
-
-    // Now, try with operations between tree simple values:
-    for(unsigned i=0; i < vnum; i++)
-        for(unsigned j=0; j < vnum; j++)
-            for(unsigned k=0; k < vnum; k++)
-            {
-                double x = val[i], y = val[j], z = val[k];
-                int vi = vid[i], vj = vid[j], vk = vid[k];
-                if( n == x + y + z )
-                    return expr_new_bin(m, expr_new_bin(m, expr_from_vid(m,vi), expr_from_vid(m,vj), TOK_PLUS), expr_from_vid(m,vk), TOK_PLUS);
-                if( n == x - y + z )
-                    return expr_new_bin(m, expr_new_bin(m, expr_from_vid(m,vi), expr_from_vid(m,vj), TOK_MINUS), expr_from_vid(m,vk), TOK_PLUS);
-                if( n == x - y - z )
-                    return expr_new_bin(m, expr_new_bin(m, expr_from_vid(m,vi), expr_from_vid(m,vj), TOK_MINUS), expr_from_vid(m,vk), TOK_MINUS);
-                if( n == x * y + z)
-                    return expr_new_bin(m, expr_new_bin(m, expr_from_vid(m,vi), expr_from_vid(m,vj), TOK_STAR), expr_from_vid(m,vk), TOK_PLUS);
-                if( n == x * y - z)
-                    return expr_new_bin(m, expr_new_bin(m, expr_from_vid(m,vi), expr_from_vid(m,vj), TOK_STAR), expr_from_vid(m,vk), TOK_MINUS);
-                if( n == x - y * z)
-                    return expr_new_bin(m, expr_from_vid(m,vi), expr_new_bin(m, expr_from_vid(m,vj), expr_from_vid(m,vk), TOK_STAR), TOK_MINUS);
-                if( n == x * y * z)
-                    return expr_new_bin(m, expr_new_bin(m, expr_from_vid(m,vi), expr_from_vid(m,vj), TOK_STAR), expr_from_vid(m,vk), TOK_STAR);
-                if( n == x / y + z )
-                    return expr_new_bin(m, expr_new_bin(m, expr_from_vid(m,vi), expr_from_vid(m,vj), TOK_SLASH), expr_from_vid(m,vk), TOK_PLUS);
-                if( n == x / y - z )
-                    return expr_new_bin(m, expr_new_bin(m, expr_from_vid(m,vi), expr_from_vid(m,vj), TOK_SLASH), expr_from_vid(m,vk), TOK_MINUS);
-                if( n == x - y / z)
-                    return expr_new_bin(m, expr_from_vid(m,vi), expr_new_bin(m, expr_from_vid(m,vj), expr_from_vid(m,vk), TOK_SLASH), TOK_MINUS);
-            }
-
-    // Same as before, adding "-":
-    for(unsigned i=0; i < vnum; i++)
-        for(unsigned j=0; j < vnum; j++)
-            for(unsigned k=0; k < vnum; k++)
-            {
-                double x = val[i], y = val[j], z = val[k];
-                int vi = vid[i], vj = vid[j], vk = vid[k];
-                if( n == -x - y - z )
-                    return expr_new_bin(m, expr_new_bin(m, expr_new_uni(m, expr_from_vid(m,vi), TOK_UMINUS), expr_from_vid(m,vj), TOK_MINUS), expr_from_vid(m,vk), TOK_MINUS);
-                if( n == -x * y - z)
-                    return expr_new_bin(m, expr_new_bin(m, expr_new_uni(m, expr_from_vid(m,vi), TOK_UMINUS), expr_from_vid(m,vj), TOK_STAR), expr_from_vid(m,vk), TOK_MINUS);
-                if( n == -x * y * z)
-                    return expr_new_bin(m, expr_new_bin(m, expr_new_uni(m, expr_from_vid(m,vi), TOK_UMINUS), expr_from_vid(m,vj), TOK_STAR), expr_from_vid(m,vk), TOK_STAR);
-                if( n == -x / y - z )
-                    return expr_new_bin(m, expr_new_bin(m, expr_new_uni(m, expr_from_vid(m,vi), TOK_UMINUS), expr_from_vid(m,vj), TOK_SLASH), expr_from_vid(m,vk), TOK_MINUS);
-            }
-
+        case enc_var:
+            return create_var(m, l, e.var, 0);
+        case enc_neg:
+            return create_var(m, l, e.var, 1);
+        case enc_not:
+            return expr_new_uni(m, create_var(m, l, e.var, 0), TOK_NOT);
+        case enc_pair:
+            return create_pair(m, l, e.pval, e.cls);
+        case enc_left:
+            return expr_new_bin(m, create_pair(m, l, e.pval, e.cls),
+                                create_var(m, l, e.var, e.neg), op_tok[e.op]);
+        case enc_right:
+            return expr_new_bin(m, create_var(m, l, e.var, e.neg),
+                                create_pair(m, l, e.pval, e.cls), op_tok[e.op]);
+        case enc_num:
+            break;
+    }
     // No simpler expression found:
     return expr_new_number(m, n);
 }
 
-static expr *create_num_assign(expr_mngr *m, cvalue_list *l, expr *prev, double x, int vid)
+static expr *create_num_assign(expr_mngr *m, clen_list *l, expr *prev, double x, int vid)
 {
     expr *toks = expr_new_bin(m, expr_new_var_num(m, vid), create_num(m, l, x), TOK_F_ASGN);
     return expr_new_stmt(m, prev, toks, STMT_LET_INV);
 }
 
-static expr *create_str_dim(expr_mngr *m, cvalue_list *l, expr *exp, unsigned len, int vid)
+static expr *create_str_dim(expr_mngr *m, clen_list *l, expr *exp, unsigned len, int vid)
 {
     // Create the DIM expression:  [,] X$(len)
     expr *dim = expr_new_bin(m, expr_new_var_str(m, vid), create_num(m, l, len), TOK_DS_L_PRN);
@@ -610,7 +837,7 @@ static void add_to_prog(expr *prog, expr *e)
     prog->lft = e;
 }
 
-int opt_replace_const(expr *prog)
+int opt_replace_const(expr *prog, enum opt_objective obj)
 {
     if( !prog )
         return 0;
@@ -620,17 +847,24 @@ int opt_replace_const(expr *prog)
     vars *v = pgm_get_vars( expr_get_program(prog) );
     unsigned nvar    = vars_get_total(v);
 
+    // Read the options once, the rest of the code only uses the context
+    int turbo = parser_get_dialect() == parser_dialect_turbo;
+
     // If not enough variables, exit
-    unsigned max_vars = (parser_get_dialect() == parser_dialect_turbo) ? 256 : 128;
+    unsigned max_vars = turbo ? 256 : 128;
 
     if( nvar >= max_vars )
         return 0;
 
+    cvar_ctx *ctx = dcalloc(1, sizeof(cvar_ctx));
+    ctx->turbo = turbo;
+    ctx->binary = get_output_type() == out_binary;
+
     // Initialize list of constant values
     cvalue_list *lst = darray_new(cvalue,256);
 
     // Adds TurboBasic XL integrated constants: %0 to %3
-    if(parser_get_dialect() == parser_dialect_turbo)
+    if( ctx->turbo )
     {
         cvalue val;
         memset(&val, 0, sizeof(val));
@@ -651,46 +885,85 @@ int opt_replace_const(expr *prog)
     }
 
     // Initialize list of gains for each possible value
-    build_clen_list(&static_clen_list, lst);
+    build_clen_list(&ctx->costs, lst);
 
     // Search all constant values in the program and store
-    // the value and number of times repeated
-    int num = update_cvalue(prog, lst);
+    // the value and number of times repeated, using a hash index
+    // to find the repeated values.
+    cvalue_index ix;
+    cvalue_index_init(&ix, 1024);
+    for(unsigned i=0; i<lst->len; i++)
+        cvalue_index_add(&ix, lst, i);
+    int num = update_cvalue(prog, lst, &ix);
+    cvalue_index_free(&ix);
 
     // If no constant values, exit.
     if( !num )
     {
+        clen_list_free(&ctx->costs);
+        free(ctx);
         darray_free(lst);
         return 0;
     }
 
-    // Now, sort constant values by "usage gain", to try to convert better constants first
-    cvalue_list_sort(lst);
-
+    // Sort by absolute value, used to select between constants with the same gain
+    cvalue_list_sort_abs(lst);
 
-    // Redo selection until no more gains are possible
-    int retry = 1;
-    while( retry )
+    // Queue with the constants that could produce a gain, ordered by the
+    // maximum gain. As the gain of a constant can only be less than the
+    // maximum, at each step we only need to calculate the real gain of the
+    // constants from the top of the queue until no other could be better.
+    int big_var = nvar > 127;
+    cvalue_queue *queue = darray_new(unsigned, 256);
+    cvalue_queue *popped = darray_new(unsigned, 16);
+    cvalue_queue_fill(queue, lst, big_var);
+
+    // Counters for the names of the string and fractional constants, kept
+    // for the whole selection so each constant gets its own variable even
+    // when the queue is filled again.
+    unsigned cs = 0, cn = 0;
+    while( queue->len && nvar<max_vars )
     {
-        retry = 0;
-
-        // Extract all constant values that produce a gain:
-        unsigned cs = 0, cn = 0;
-        for(unsigned i=0; i<lst->len && nvar<max_vars; i++)
+        // Variables numbers more than 127 use one extra byte each time
+        if( big_var != (nvar > 127) )
         {
-            cvalue *cv = lst->data + i;
+            big_var = nvar > 127;
+            cvalue_queue_fill(queue, lst, big_var);
+        }
 
-            // Skip if already done
-            if( cv->status )
-                continue;
+        // Search constant with the best gain
+        int best_gain = -1;
+        unsigned best = 0;
+        popped->len = 0;
+        while( queue->len )
+        {
+            unsigned top = queue->data[0];
+            int max_gain = lst->data[top].max_gain;
+            if( max_gain < best_gain || (max_gain == best_gain && top > best) )
+                break;
+            cvalue_queue_pop(queue, lst);
+            const cvalue *c = lst->data + top;
+            int gain = -cvalue_saved_bytes(&ctx->costs, c) - (big_var ? c->count : 0);
+            darray_add(popped, top);
+            if( gain > best_gain || (gain == best_gain && top < best) )
+            {
+                best_gain = gain;
+                best = top;
+            }
+        }
+        // Return the rest to the queue, the gain could be better later
+        for(unsigned i=0; i<popped->len; i++)
+            if( best_gain < 0 || popped->data[i] != best )
+                cvalue_queue_push(queue, lst, popped->data[i]);
 
-            int bytes = cvalue_saved_bytes(cv);
-            // Add one extra byte if the variable number is more than 127:
-            if( nvar > 127 )
-                bytes += cv->count;
+        // Reading a variable takes about the same time as reading the
+        // constant, so only the size is considered.
+        if( best_gain < 0 || !opt_cost_accept(obj, -best_gain, 0) )
+            break;
 
-            if( bytes > 0 )
-                continue;
+        {
+            cvalue *cv = lst->data + best;
+            int bytes = -best_gain;
 
             // Ok, we can replace the variable
             if( cv->str )
@@ -701,11 +974,14 @@ int opt_replace_const(expr *prog)
                 nvar++;
                 info_print(expr_get_file_name(prog), 0, "replacing constant var %s$=\"%.*s\" (%d times, %d bytes)\n",
                         name, cv->slen, cv->str, cv->count, bytes);
+                remark("const_replace", expr_get_file_name(prog), 0, remark_applied, -bytes, 0,
+                       "replaced constant string of %d chars with %s$ (%d times)",
+                       cv->slen, name, cv->count);
                 // Creates the variable
                 cv->vid = vars_new_var(v, name, vtString, expr_get_file_name(prog), 0);
                 cv->status = 1;
                 // Replace all instances of the constant value with the variables
-                replace_cvalue(prog, cv);
+                replace_cvalue(prog, cv, ctx->binary);
             }
             else
             {
@@ -732,20 +1008,46 @@ int opt_replace_const(expr *prog)
                 nvar++;
                 info_print(expr_get_file_name(prog), 0, "replacing constant var %s=%g (%d times, %d bytes)\n",
                         name, cv->num, cv->count, bytes);
+                remark("const_replace", expr_get_file_name(prog), 0, remark_applied, -bytes, 0,
+                       "replaced constant %g with %s (%d times)", cv->num, name, cv->count);
                 cv->vid = vars_new_var(v, name, vtFloat, expr_get_file_name(prog), 0);
                 cv->status = 1;
                 // Replace all instances of the constant value with the variables
-                replace_cvalue(prog, cv);
-                // Rebuild cost list and retry
-                build_clen_list(&static_clen_list, lst);
-                retry = 1;
-                break;
+                replace_cvalue(prog, cv, ctx->binary);
+                // Add to the cost list, the cost of other constants could be less now
+                clen_list_add(&ctx->costs, cv->num, cv->vid);
             }
         }
     }
+    darray_free(popped);
+    darray_free(queue);
 
-    // Sort again by absolute value, this tends to generate smaller code
-    cvalue_list_sort_abs(lst);
+    // Report the repeated constants not replaced
+    if( remarks_enabled() )
+    {
+        int big_var = nvar > 127;
+        const char *why = nvar < max_vars ? "does not save bytes" : "no free variables";
+        for(unsigned i=0; i<lst->len; i++)
+        {
+            const cvalue *c = lst->data + i;
+            if( c->status || c->count < 2 )
+                continue;
+            int bytes = -cvalue_saved_bytes(&ctx->costs, c) - (big_var ? c->count : 0);
+            if( c->str )
+                remark("const_replace", expr_get_file_name(prog), 0, remark_missed, bytes, 0,
+                       "constant string of %d chars (%d times): %s", c->slen, c->count, why);
+            else
+                remark("const_replace", expr_get_file_name(prog), 0, remark_missed, bytes, 0,
+                       "constant %g (%d times): %s", c->num, c->count, why);
+        }
+    }
+
+    // List of values already emitted, used to create the initializations
+    clen_list *emit = &ctx->emit;
+    clen_list_clear(emit);
+    for(unsigned i=0; i<lst->len; i++)
+        if( lst->data[i].status == 2 && !lst->data[i].str )
+            clen_list_add(emit, lst->data[i].num, lst->data[i].vid);
 
     // Now, add all variable initializations to the program, first numeric, then strings:
     expr *init = 0, *last_stmt = 0, *dim = 0;
@@ -754,9 +1056,10 @@ int opt_replace_const(expr *prog)
         cvalue *cv = lst->data + i;
         if( cv->status == 1 && !cv->str )
         {
-           last_stmt = create_num_assign(prog->mngr, lst, last_stmt, cv->num, cv->vid);
+           last_stmt = create_num_assign(prog->mngr, emit, last_stmt, cv->num, cv->vid);
            if( !init ) init = last_stmt;
            cv->status = 2;
+           clen_list_add(emit, cv->num, cv->vid);
         }
     }
     // Now, all DIM expressions
@@ -765,7 +1068,7 @@ int opt_replace_const(expr *prog)
         cvalue *cv = lst->data + i;
         if( cv->status == 1 && cv->str )
         {
-            dim = create_str_dim(prog->mngr, lst, dim, cv->slen, cv->vid);
+            dim = create_str_dim(prog->mngr, emit, dim, cv->slen, cv->vid);
             cv->status = 2;
         }
     }
@@ -788,6 +1091,9 @@ int opt_replace_const(expr *prog)
 
     add_to_prog(prog, init);
 
+    clen_list_free(&ctx->emit);
+    clen_list_free(&ctx->costs);
+    free(ctx);
     darray_free(lst);
     return 0;
 }
@@ -17,8 +17,10 @@
  */
 #pragma once
 
+#include "optcost.h"
+
 typedef struct expr_struct expr;
 
 // Replace constants with variables
-int opt_replace_const(expr *ex);
+int opt_replace_const(expr *ex, enum opt_objective obj);
 
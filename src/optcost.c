@@ -0,0 +1,206 @@
+/*
+ *  Basic Parser - TurboBasic XL compatible parsing and transformation tool.
+ *  Copyright (C) 2015 Daniel Serpell
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "optcost.h"
+#include "expr.h"
+#include "parser.h"
+#include "profile.h"
+#include "program.h"
+
+int opt_cost_num_bytes(double x)
+{
+    if( parser_get_dialect() == parser_dialect_turbo &&
+        (x == 0 || x == 1 || x == 2 || x == 3) )
+        return 1;
+    return OPT_COST_NUM_BYTES;
+}
+
+int opt_cost_var_bytes(unsigned id)
+{
+    // Variables from 128 are written with a prefix token
+    return id < 128 ? 1 : 2;
+}
+
+int opt_cost_expr_bytes(const expr *ex)
+{
+    if( !ex )
+        return 0;
+    if( ex->type == et_c_number || ex->type == et_c_hexnumber )
+        return opt_cost_num_bytes(ex->num);
+    if( ex->type == et_var_number )
+        return opt_cost_var_bytes(ex->var);
+    if( ex->type == et_c_string )
+        return 2 + ex->slen;
+    int b = 1 + opt_cost_expr_bytes(ex->lft) + opt_cost_expr_bytes(ex->rgt);
+    // Opening and closing parenthesis
+    if( ex->type == et_tok && tok_need_parens(ex->tok) )
+        b += tok_need_parens(ex->tok) == 3 ? 2 : 1;
+    return b;
+}
+
+int opt_cost_expr_time(const expr *ex)
+{
+    if( !ex )
+        return 0;
+    int t = opt_cost_expr_time(ex->lft) + opt_cost_expr_time(ex->rgt);
+    if( ex->type == et_tok && opt_cost_tok_time(ex->tok) > 0 )
+        t += opt_cost_tok_time(ex->tok);
+    return t;
+}
+
+// TurboBasic XL has its own floating point routines, much faster than the
+// OS routines used by Atari BASIC, specially in multiplication, division
+// and transcendental functions. Tokens only available in TurboBasic XL
+// use the same time in both tables.
+int opt_cost_tok_time(enum enum_tokens tok)
+{
+    int turbo = parser_get_dialect() == parser_dialect_turbo;
+    switch( tok )
+    {
+        case TOK_L_PRN:
+        case TOK_UPLUS:
+        case TOK_PER_0:
+        case TOK_PER_1:
+        case TOK_PER_2:
+        case TOK_PER_3:
+            return 0;
+        case TOK_AND:
+        case TOK_OR:
+        case TOK_NOT:
+        case TOK_UMINUS:
+            return 1;
+        case TOK_ABS:
+        case TOK_SGN:
+        case TOK_PEEK:
+        case TOK_DPEEK:
+        case TOK_TRUNC:
+        case TOK_FRAC:
+            return 2;
+        case TOK_N_LEQ:
+        case TOK_N_NEQ:
+        case TOK_N_GEQ:
+        case TOK_N_LE:
+        case TOK_N_GE:
+        case TOK_N_EQ:
+        case TOK_PLUS:
+        case TOK_MINUS:
+            return turbo ? 2 : 4;
+        case TOK_INT:
+            return turbo ? 2 : 8;
+        case TOK_ANDPER:
+        case TOK_EXCLAM:
+        case TOK_EXOR:
+            return 3;
+        case TOK_STAR:
+            return turbo ? 4 : 12;
+        case TOK_SLASH:
+            return turbo ? 8 : 24;
+        case TOK_DIV:
+        case TOK_MOD:
+            return 8;
+        case TOK_SQR:
+            return turbo ? 20 : 100;
+        case TOK_EXP:
+        case TOK_LOG:
+        case TOK_CLOG:
+        case TOK_ATN:
+        case TOK_COS:
+        case TOK_SIN:
+            return turbo ? 20 : 60;
+        case TOK_CARET:
+            return turbo ? 30 : 120;
+        default:
+            // RND, USR, STICK, FRE, ADR, TIME, ERR, string functions, etc.
+            return -1;
+    }
+}
+
+int opt_cost_stmt_time(enum enum_statements stmt)
+{
+    int turbo = parser_get_dialect() == parser_dialect_turbo;
+    switch( stmt )
+    {
+        case STMT_REM:
+        case STMT_REM_:
+        case STMT_REM_HIDDEN:
+        case STMT_DATA:
+        case STMT_ENDIF_INVISIBLE:
+            return 0;
+        case STMT_LET:
+        case STMT_LET_INV:
+            // Statement dispatch and storing the result
+            return 3;
+        case STMT_GOTO:
+        case STMT_GO_TO:
+        case STMT_GOSUB:
+        case STMT_IF_NUMBER:
+        case STMT_ON:
+        case STMT_RESTORE:
+        case STMT_TRAP:
+            // Searching the target line, Atari BASIC is a lot slower.
+            return turbo ? 4 : 16;
+        case STMT_RETURN:
+        case STMT_NEXT:
+        case STMT_POP:
+            // Searching the runtime stack
+            return turbo ? 3 : 6;
+        case STMT_EXEC:
+        case STMT_EXEC_PAR:
+            // Searching the PROC label
+            return 6;
+        case STMT_ELSE:
+        case STMT_ENDIF:
+        case STMT_WEND:
+        case STMT_UNTIL:
+        case STMT_LOOP:
+        case STMT_EXIT:
+            // Jump scanning the statements
+            return 4;
+        default:
+            return 2;
+    }
+}
+
+long opt_cost_exec_count(const expr *ex)
+{
+    const profile *p = pgm_get_profile(expr_get_program(ex));
+    if( !p )
+        return -1;
+    unsigned long n = profile_get_count(p, expr_get_file_line(ex));
+    return n < OPT_COST_MAX_COUNT ? (long)n : OPT_COST_MAX_COUNT;
+}
+
+int opt_cost_hot_time(const expr *ex, int time)
+{
+    long n = opt_cost_exec_count(ex);
+    return n < 0 ? time : time * n;
+}
+
+int opt_cost_accept(enum opt_objective obj, int bytes, int time)
+{
+    switch( obj )
+    {
+        case opt_obj_size:
+            return bytes < 0 || (bytes == 0 && time > 0);
+        case opt_obj_speed:
+            return time > 0 || (time == 0 && bytes < 0);
+        case opt_obj_balanced:
+        default:
+            return (time > 0 || bytes < 0) && bytes <= time * OPT_COST_BYTES_PER_UNIT;
+    }
+}
@@ -0,0 +1,92 @@
+/*
+ *  Basic Parser - TurboBasic XL compatible parsing and transformation tool.
+ *  Copyright (C) 2015 Daniel Serpell
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+#pragma once
+
+#include "tokens.h"
+#include "statements.h"
+
+typedef struct expr_struct expr;
+
+// Estimated sizes and execution times of the interpreter, shared by all
+// the optimization passes. Times are in arbitrary units, roughly the time
+// of one addition in TurboBasic XL divided by two.
+
+// What the optimizations try to improve
+enum opt_objective {
+    opt_obj_balanced,   // Faster code, growing a few bytes per unit of time
+    opt_obj_size,       // Smaller code, faster only if the size is the same
+    opt_obj_speed       // Faster code, regardless of the size
+};
+
+// Maximum number of bytes the program can grow for each unit of time saved
+// in the balanced objective.
+#define OPT_COST_BYTES_PER_UNIT 4
+
+// Bytes of a numeric constant: token and 6 BCD bytes.
+#define OPT_COST_NUM_BYTES      7
+// Bytes of a variable in the VVT.
+#define OPT_COST_VVT_BYTES      8
+// Bytes used by a new variable: VVT plus a short name in the VNT.
+#define OPT_COST_VAR_SLOT_BYTES 10
+// Bytes of a line without statements: line number and length.
+#define OPT_COST_LINE_BYTES     3
+// Bytes of a statement without arguments: length and token.
+#define OPT_COST_STMT_BYTES     2
+// Bytes of an assignment without the variable and the expression:
+// statement, "=" and the end of the statement.
+#define OPT_COST_LET_BYTES      (OPT_COST_STMT_BYTES + 2)
+
+// Returns the bytes of the numeric constant "x", assuming that small
+// constants are replaced with %0 to %3 in TurboBasic XL.
+int opt_cost_num_bytes(double x);
+
+// Returns the bytes used to reference the variable number "id".
+int opt_cost_var_bytes(unsigned id);
+
+// Returns the bytes used by the expression in the tokenized program,
+// including the parenthesis written by the tokens.
+int opt_cost_expr_bytes(const expr *ex);
+
+// Returns the estimated time to evaluate the expression, adding the time of
+// the numeric operations.
+int opt_cost_expr_time(const expr *ex);
+
+// Returns the estimated time to evaluate the token, or -1 if the token is
+// not a numeric operation without side effects. Uses the table of the
+// current dialect.
+int opt_cost_tok_time(enum enum_tokens tok);
+
+// Returns the estimated time to execute the statement, not including the
+// evaluation of the arguments. Uses the table of the current dialect.
+int opt_cost_stmt_time(enum enum_statements stmt);
+
+// Maximum execution count used to scale the time, so that the scaled
+// times don't overflow.
+#define OPT_COST_MAX_COUNT      65536
+
+// Returns the number of times the statement is executed from the profile of
+// the program, or -1 if there is no profile.
+long opt_cost_exec_count(const expr *ex);
+
+// Returns the time saved by saving "time" units on each execution of the
+// statement: multiplied by the execution count if there is a profile.
+int opt_cost_hot_time(const expr *ex, int time);
+
+// Returns true if a transformation that adds "bytes" bytes to the program
+// and saves "time" units of time is an improvement for the objective.
+int opt_cost_accept(enum opt_objective obj, int bytes, int time);
@@ -0,0 +1,537 @@
+/*
+ *  Basic Parser - TurboBasic XL compatible parsing and transformation tool.
+ *  Copyright (C) 2015 Daniel Serpell
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "optcse.h"
+#include "expr.h"
+#include "vars.h"
+#include "dbg.h"
+#include "dmem.h"
+#include "darray.h"
+#include "parser.h"
+#include "program.h"
+#include "optcost.h"
+#include "optlinenum.h"
+#include "remarks.h"
+#include "optutil.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Maximum number of expressions tracked in one block
+#define CSE_MAX_ENTRIES     1024
+
+// One expression found in the current block
+typedef struct {
+    expr *key;      // First occurrence, without parenthesis
+    expr *stmt;     // Statement of the first occurrence
+    expr *line;     // Line number of the first occurrence
+    int count;      // Number of occurrences
+    int open;       // Operands not modified since the first occurrence
+    int weight;     // Estimated time to evaluate the expression
+    int bytes;      // Size of the expression in the tokenized program
+    int mem;        // Expression reads memory
+} cse_entry;
+
+// Location of each occurrence of an expression
+typedef struct {
+    unsigned entry;
+    expr *node;
+} cse_occur;
+
+typedef darray(cse_entry) cse_entry_list;
+typedef darray(cse_occur) cse_occur_list;
+typedef darray(int) cse_temp_list;
+
+typedef struct {
+    vars *v;
+    lnum_targets *targets;
+    cse_entry_list *lst;    // Expressions in current block
+    cse_occur_list *occ;    // Occurrences of the expressions
+    cse_temp_list *temps;   // Temporary variables created
+    unsigned nvar;          // Current number of variables
+    unsigned max_vars;      // Maximum number of variables
+    unsigned block_temps;   // Temporary variables used in current block
+    enum opt_objective obj; // Optimization objective
+    expr *line;             // Current line number
+    int num;                // Number of expressions replaced
+} cse_ctx;
+
+static int expr_is_cnum(const expr *ex)
+{
+    return ex && (ex->type == et_c_number || ex->type == et_c_hexnumber);
+}
+
+// Returns the estimated time to evaluate the token, or -1 if the token
+// can't be part of a common expression. Sets "mem" if the result depends
+// on the memory contents.
+static int tok_weight(const expr *ex, int *mem)
+{
+    switch( ex->tok )
+    {
+        case TOK_ATN:
+        case TOK_COS:
+        case TOK_SIN:
+            // Depends on the DEG/RAD mode, stored in memory
+            *mem = 1;
+            break;
+        case TOK_PEEK:
+        case TOK_DPEEK:
+            // Only constant addresses that are not modified by the OS
+            if( !expr_is_cnum(ex->rgt) || opt_volatile_addr(ex->rgt->num) ||
+                (ex->tok == TOK_DPEEK && opt_volatile_addr(ex->rgt->num + 1)) )
+                return -1;
+            *mem = 1;
+            break;
+        default:
+            break;
+    }
+    return opt_cost_tok_time(ex->tok);
+}
+
+// Returns true if the expression is numeric and does not have side
+// effects, accumulating the estimated time to evaluate it.
+static int pure_expr(const expr *ex, int *w, int *mem)
+{
+    switch( ex->type )
+    {
+        case et_c_number:
+        case et_c_hexnumber:
+        case et_var_number:
+            return 1;
+        case et_tok:
+            break;
+        default:
+            return 0;
+    }
+    int tw = tok_weight(ex, mem);
+    if( tw < 0 )
+        return 0;
+    *w += tw;
+    if( ex->lft && !pure_expr(ex->lft, w, mem) )
+        return 0;
+    if( ex->rgt && !pure_expr(ex->rgt, w, mem) )
+        return 0;
+    return 1;
+}
+
+static int has_var(const expr *ex, unsigned id)
+{
+    if( !ex )
+        return 0;
+    if( ex->type == et_var_number )
+        return ex->var == id;
+    return has_var(ex->lft, id) || has_var(ex->rgt, id);
+}
+
+// Operand modified, the following occurrences are a new expression
+static void close_var(cse_ctx *c, unsigned id)
+{
+    cse_entry *e;
+    darray_foreach(e, c->lst)
+        if( e->open && has_var(e->key, id) )
+            e->open = 0;
+}
+
+static void close_vars(cse_ctx *c, const expr *ex)
+{
+    if( !ex )
+        return;
+    if( ex->type == et_var_number )
+        close_var(c, ex->var);
+    close_vars(c, ex->lft);
+    close_vars(c, ex->rgt);
+}
+
+// Memory modified, close all expressions that read memory
+static void close_mem(cse_ctx *c)
+{
+    cse_entry *e;
+    darray_foreach(e, c->lst)
+        if( e->mem )
+            e->open = 0;
+}
+
+static void close_all(cse_ctx *c)
+{
+    cse_entry *e;
+    darray_foreach(e, c->lst)
+        e->open = 0;
+}
+
+static void add_occurrence(cse_ctx *c, expr *node, expr *key, expr *stmt, int w, int mem)
+{
+    cse_occur o;
+    o.node = node;
+    for(o.entry = 0; o.entry < darray_len(c->lst); o.entry++)
+    {
+        cse_entry *e = &darray_i(c->lst, o.entry);
+        if( e->open && opt_expr_equal(e->key, key) )
+        {
+            e->count ++;
+            darray_add(c->occ, o);
+            return;
+        }
+    }
+    if( darray_len(c->lst) >= CSE_MAX_ENTRIES )
+        return;
+
+    cse_entry e;
+    e.key = key;
+    e.stmt = stmt;
+    e.line = c->line;
+    e.count = 1;
+    e.open = 1;
+    e.weight = w;
+    e.bytes = opt_cost_expr_bytes(key);
+    e.mem = mem;
+    darray_add(c->lst, e);
+    darray_add(c->occ, o);
+}
+
+// Adds all the expressions read by the statement
+static void collect(cse_ctx *c, expr *ex, expr *stmt)
+{
+    if( !ex )
+        return;
+    expr *k = opt_strip_prn(ex);
+    int w = 0, mem = 0;
+    if( k->type == et_tok && pure_expr(k, &w, &mem) && w > 0 )
+        add_occurrence(c, ex, k, stmt, w, mem);
+    collect(c, k->lft, stmt);
+    collect(c, k->rgt, stmt);
+}
+
+static void scan_assign(cse_ctx *c, expr *ex)
+{
+    expr *a = ex->rgt;
+    if( !a || a->type != et_tok || !a->lft ||
+        (a->tok != TOK_F_ASGN && a->tok != TOK_S_ASGN) )
+    {
+        close_vars(c, a);
+        close_mem(c);
+        return;
+    }
+    collect(c, a->rgt, ex);
+    if( a->lft->type == et_var_number )
+        close_var(c, a->lft->var);
+    else
+    {
+        // Array element or string
+        if( a->lft->type == et_tok )
+            collect(c, a->lft->rgt, ex);
+        close_mem(c);
+    }
+}
+
+// Adds the expressions read by the statement that don't use the variable
+static void collect_novar(cse_ctx *c, expr *ex, expr *stmt, unsigned id)
+{
+    if( !ex )
+        return;
+    if( !has_var(ex, id) )
+    {
+        collect(c, ex, stmt);
+        return;
+    }
+    expr *k = opt_strip_prn(ex);
+    collect_novar(c, k->lft, stmt, id);
+    collect_novar(c, k->rgt, stmt, id);
+}
+
+// FOR evaluates the start value, assigns the variable and then evaluates
+// the limit and step. The temporary variables are assigned before the FOR,
+// so expressions using the new value of the variable are not collected.
+static void scan_for(cse_ctx *c, expr *ex)
+{
+    expr *var, *start, *limit, *step;
+    if( !opt_for_parts(ex, &var, &start, &limit, &step) )
+        return;
+    collect(c, start, ex);
+    close_var(c, var->var);
+    collect_novar(c, limit, ex, var->var);
+    collect_novar(c, step, ex, var->var);
+}
+
+// Scans one block of statements starting at "start", that can only be
+// entered at the start, and returns the first node after the block. Inside
+// the block, control can only exit at the end or at conditional jumps, so
+// the first statement of the block is always executed before the others.
+static expr *scan_block(cse_ctx *c, expr *start)
+{
+    darray_len(c->lst) = 0;
+    darray_len(c->occ) = 0;
+
+    for(expr *ex = start; ex != 0; ex = ex->lft)
+    {
+        if( ex->type == et_lnum )
+        {
+            if( ex != start && opt_is_target(c->targets, ex) )
+                return ex;
+            c->line = ex;
+            continue;
+        }
+        if( ex->type != et_stmt )
+            continue;
+
+        enum opt_stmt_kind k = opt_stmt_kind(ex->stmt);
+        // FOR and UNTIL read expressions before continuing elsewhere, other
+        // structured statements and calls start or end a block.
+        if( ex->stmt == STMT_FOR || ex->stmt == STMT_UNTIL )
+            k = opt_sk_last;
+        else if( k == opt_sk_block || k == opt_sk_call )
+            return ex != start ? ex : ex->lft;
+
+        // Machine code can modify anything
+        if( k != opt_sk_none && opt_has_usr(ex->rgt) )
+        {
+            close_all(c);
+            if( k == opt_sk_last )
+                return ex->lft;
+            continue;
+        }
+
+        switch( k )
+        {
+            case opt_sk_none:
+            case opt_sk_block:
+            case opt_sk_call:
+                break;
+            case opt_sk_read:
+                collect(c, ex->rgt, ex);
+                break;
+            case opt_sk_clobber:
+                collect(c, ex->rgt, ex);
+                close_mem(c);
+                break;
+            case opt_sk_assign:
+                scan_assign(c, ex);
+                break;
+            case opt_sk_write:
+                close_vars(c, ex->rgt);
+                close_mem(c);
+                break;
+            case opt_sk_last:
+                if( ex->stmt == STMT_FOR )
+                    scan_for(c, ex);
+                else
+                    collect(c, ex->rgt, ex);
+                return ex->lft;
+        }
+    }
+    return 0;
+}
+
+// Returns the temporary variable number "n", or -1 if not created yet
+static int get_temp(cse_ctx *c, unsigned n)
+{
+    if( n < darray_len(c->temps) )
+        return darray_i(c->temps, n);
+    return -1;
+}
+
+static int new_temp(cse_ctx *c, const char *fname, int fline)
+{
+    char name[64];
+    // Skip names already used in the program
+    for(unsigned i = darray_len(c->temps); ; i++)
+    {
+        sprintf(name, "__t%u", i);
+        if( vars_search(c->v, name, vtFloat) < 0 )
+            break;
+    }
+    int id = vars_new_var(c->v, name, vtFloat, fname, fline);
+    darray_add(c->temps, id);
+    c->nvar ++;
+    return id;
+}
+
+// Calculates the gain in speed and the bytes added by replacing the
+// expression. Returns NULL if the expression can be replaced, or the reason.
+static const char *entry_gain(cse_ctx *c, const cse_entry *e, int *gain, int *bytes)
+{
+    int tmp = get_temp(c, c->block_temps);
+    int vc, slot = 0;
+    *gain = *bytes = 0;
+    if( tmp < 0 )
+    {
+        if( c->nvar >= c->max_vars )
+            return "no free variables";
+        vc = opt_cost_var_bytes(c->nvar);
+        slot = OPT_COST_VAR_SLOT_BYTES;
+    }
+    else
+        vc = opt_cost_var_bytes(tmp);
+
+    *gain = (e->count - 1) * e->weight - opt_cost_stmt_time(STMT_LET_INV);
+    *gain = opt_cost_hot_time(e->stmt, *gain);
+    // New variable, assignment statement (statement length, token, variable,
+    // "=", expression and end) minus the saved bytes on each occurrence.
+    int let_bytes = OPT_COST_LET_BYTES + vc + e->bytes;
+    *bytes = slot + let_bytes - e->count * (e->bytes - vc);
+    if( !opt_line_fits(e->line, let_bytes, 255) )
+        return "line too long";
+    if( *gain <= 0 || !opt_cost_accept(c->obj, *bytes, *gain) )
+        return "not profitable";
+    return 0;
+}
+
+static void set_var(expr *ex, int id)
+{
+    ex->type = et_var_number;
+    ex->var = id;
+    ex->lft = 0;
+    ex->rgt = 0;
+}
+
+// Stores the expression in a temporary variable, inserting the assignment
+// before the statement of the first occurrence.
+static void replace_entry(cse_ctx *c, unsigned n, int gain, int bytes)
+{
+    cse_entry *e = &darray_i(c->lst, n);
+    expr *s = e->stmt;
+    expr_mngr *m = s->mngr;
+
+    int tmp = get_temp(c, c->block_temps);
+    if( tmp < 0 )
+        tmp = new_temp(c, expr_get_file_name(s), s->file_line);
+    c->block_temps ++;
+
+    info_print(expr_get_file_name(s), s->file_line,
+               "storing repeated expression in '%s' (%d times, %d bytes).\n",
+               vars_get_long_name(c->v, tmp), e->count, bytes);
+    remark("cse", expr_get_file_name(s), s->file_line, remark_applied, -bytes, gain,
+           "stored repeated expression in '%s' (%d times)", vars_get_long_name(c->v, tmp), e->count);
+
+    // Copy the expression before replacing the occurrences
+    expr *val = expr_new_void(m);
+    *val = *e->key;
+
+    cse_occur *o;
+    darray_foreach(o, c->occ)
+        if( o->entry == n )
+            set_var(o->node, tmp);
+
+    // Move the statement to a new node, the old node is the assignment
+    expr *nxt = expr_new_stmt(m, 0, s->rgt, s->stmt);
+    nxt->lft = s->lft;
+    nxt->file_line = s->file_line;
+
+    expr *var = expr_new_var_num(m, tmp);
+    var->file_line = s->file_line;
+    s->stmt = STMT_LET_INV;
+    s->rgt = expr_new_bin(m, var, val, TOK_F_ASGN);
+    s->rgt->file_line = s->file_line;
+    s->lft = nxt;
+    c->num ++;
+}
+
+// Selects the expression with more gain in the current block
+static int best_entry(cse_ctx *c, int *gain, int *bytes)
+{
+    int best = -1, best_gain = 0;
+    for(unsigned i = 0; i < darray_len(c->lst); i++)
+    {
+        const cse_entry *e = &darray_i(c->lst, i);
+        int g, b;
+        if( e->count < 2 || entry_gain(c, e, &g, &b) )
+            continue;
+        if( g > best_gain )
+        {
+            best = i;
+            best_gain = g;
+            *gain = g;
+            *bytes = b;
+        }
+    }
+    return best;
+}
+
+// Reports the repeated expressions of the block that were not replaced
+static void report_missed(cse_ctx *c)
+{
+    if( !remarks_enabled() )
+        return;
+    cse_entry *e;
+    darray_foreach(e, c->lst)
+    {
+        int g, b;
+        if( e->count < 2 )
+            continue;
+        const char *why = entry_gain(c, e, &g, &b);
+        remark("cse", expr_get_file_name(e->stmt), e->stmt->file_line, remark_missed, -b, g,
+               "repeated expression (%d times): %s", e->count, why ? why : "overlaps other expression");
+    }
+}
+
+int opt_cse(expr *prog, enum opt_objective obj)
+{
+    if( !prog )
+        return 0;
+
+    cse_ctx c;
+    c.v = pgm_get_vars( expr_get_program(prog) );
+    c.nvar = vars_get_total(c.v);
+    c.max_vars = (parser_get_dialect() == parser_dialect_turbo) ? 256 : 128;
+    c.targets = opt_targets_new();
+    c.lst = darray_new(cse_entry, 64);
+    c.occ = darray_new(cse_occur, 64);
+    c.temps = darray_new(int, 16);
+    c.num = 0;
+    c.obj = obj;
+    c.line = 0;
+    opt_search_targets(c.targets, prog);
+
+    if( c.targets->all )
+    {
+        info_print(expr_get_file_name(prog), 0,
+                   "target line number not constant, expressions are not reused across lines.\n");
+        remark("cse", expr_get_file_name(prog), 0, remark_missed, 0, 0,
+               "target line number not constant, expressions are not reused across lines");
+    }
+
+    expr *ex = prog;
+    while( ex )
+    {
+        expr *end;
+        c.block_temps = 0;
+        // Replace one expression at a time, rescanning the block each time
+        for(;;)
+        {
+            int gain = 0, bytes = 0;
+            end = scan_block(&c, ex);
+            int n = best_entry(&c, &gain, &bytes);
+            if( n < 0 )
+                break;
+            replace_entry(&c, n, gain, bytes);
+        }
+        report_missed(&c);
+        ex = end;
+    }
+
+    if( c.num )
+        info_print(expr_get_file_name(prog), 0,
+                   "replaced %d repeated expressions, using %d temporary variables.\n",
+                   c.num, (int)darray_len(c.temps));
+
+    darray_free(c.temps);
+    darray_free(c.occ);
+    darray_free(c.lst);
+    opt_targets_free(c.targets);
+    return 0;
+}
@@ -0,0 +1,480 @@
+/*
+ *  Basic Parser - TurboBasic XL compatible parsing and transformation tool.
+ *  Copyright (C) 2015 Daniel Serpell
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "optdpeek.h"
+#include "expr.h"
+#include "dbg.h"
+#include "optcost.h"
+#include "parser.h"
+#include "remarks.h"
+#include "optutil.h"
+#include <math.h>
+#include <string.h>
+
+// Replaces 16 bit memory accesses written with two PEEK or POKE with the
+// TurboBasic XL statements, that are shorter and a lot faster:
+//  - PEEK(A)+256*PEEK(A+1) to DPEEK(A), in any order of the operands,
+//  - POKE A,L:POKE A+1,H to DPOKE A,L+256*H, with L and H constants,
+//  - POKE A,V-256*INT(V/256):POKE A+1,INT(V/256) to DPOKE A,V, also with
+//    "V&255" or "V MOD 256" as the low byte and "V DIV 256" as the high
+//    byte, and with the two POKE in any order. V must always be an
+//    integer, as the bytes of a fractional value are rounded differently.
+//
+// The address A+1 can also be written as a constant when A is a constant,
+// as produced by the constant folding.
+
+typedef struct {
+    expr *prog;
+    int count;  // Number of replacements
+} dp_ctx;
+
+static int expr_is_cnum(const expr *ex)
+{
+    return ex && (ex->type == et_c_number || ex->type == et_c_hexnumber);
+}
+
+static int check_hidden(const expr *ex)
+{
+    return ex && ex->type == et_stmt && ex->stmt == STMT_REM_HIDDEN;
+}
+
+static int is_cnum(const expr *ex, double x)
+{
+    return expr_is_cnum(ex) && ex->num == x;
+}
+
+// Returns true if the expression has side effects, so it can't be
+// evaluated a different number of times.
+static int has_side_effects(const expr *ex)
+{
+    if( !ex )
+        return 0;
+    if( ex->type == et_tok && (ex->tok == TOK_USR || ex->tok == TOK_RND || ex->tok == TOK_RAND) )
+        return 1;
+    return has_side_effects(ex->lft) || has_side_effects(ex->rgt);
+}
+
+// Returns true if the expression only uses constants, variables and
+// arithmetic, so the value does not change after a POKE.
+static int is_simple(const expr *ex)
+{
+    if( !ex )
+        return 1;
+    switch( ex->type )
+    {
+        case et_c_number:
+        case et_c_hexnumber:
+        case et_var_number:
+            return 1;
+        case et_tok:
+            switch( ex->tok )
+            {
+                case TOK_L_PRN:
+                case TOK_PLUS:
+                case TOK_MINUS:
+                case TOK_STAR:
+                case TOK_SLASH:
+                case TOK_UMINUS:
+                case TOK_UPLUS:
+                case TOK_INT:
+                case TOK_DIV:
+                case TOK_MOD:
+                case TOK_ANDPER:
+                    return is_simple(ex->lft) && is_simple(ex->rgt);
+                default:
+                    return 0;
+            }
+        default:
+            return 0;
+    }
+}
+
+static int uses_var(const expr *ex, unsigned var)
+{
+    if( !ex )
+        return 0;
+    if( ex->type == et_var_number && ex->var == var )
+        return 1;
+    return uses_var(ex->lft, var) || uses_var(ex->rgt, var);
+}
+
+static int var_is_int(const dp_ctx *c, unsigned var);
+
+// Returns true if the expression always gives an integer. Inside the
+// assignments to the variable "var" (-1 if none), only that variable is
+// assumed to be an integer.
+static int is_int_expr(const dp_ctx *c, const expr *ex, int var)
+{
+    if( !ex )
+        return 0;
+    if( expr_is_cnum(ex) )
+        return ex->num == floor(ex->num);
+    if( ex->type == et_var_number )
+        return var < 0 ? var_is_int(c, ex->var) : ex->var == (unsigned)var;
+    if( ex->type != et_tok )
+        return 0;
+    switch( ex->tok )
+    {
+        case TOK_N_LEQ:
+        case TOK_N_NEQ:
+        case TOK_N_GEQ:
+        case TOK_N_LE:
+        case TOK_N_GE:
+        case TOK_N_EQ:
+        case TOK_S_LEQ:
+        case TOK_S_NEQ:
+        case TOK_S_GEQ:
+        case TOK_S_LE:
+        case TOK_S_GE:
+        case TOK_S_EQ:
+        case TOK_NOT:
+        case TOK_OR:
+        case TOK_AND:
+        case TOK_INT:
+        case TOK_TRUNC:
+        case TOK_DIV:
+        case TOK_SGN:
+        case TOK_ANDPER:
+        case TOK_EXCLAM:
+        case TOK_EXOR:
+        case TOK_PEEK:
+        case TOK_DPEEK:
+        case TOK_ASC:
+        case TOK_LEN:
+        case TOK_ADR:
+        case TOK_PADDLE:
+        case TOK_STICK:
+        case TOK_PTRIG:
+        case TOK_STRIG:
+        case TOK_PER_0:
+        case TOK_PER_1:
+        case TOK_PER_2:
+        case TOK_PER_3:
+            return 1;
+        case TOK_L_PRN:
+        case TOK_UPLUS:
+        case TOK_UMINUS:
+            return is_int_expr(c, ex->rgt, var);
+        case TOK_PLUS:
+        case TOK_MINUS:
+        case TOK_STAR:
+        case TOK_MOD:
+            return is_int_expr(c, ex->lft, var) && is_int_expr(c, ex->rgt, var);
+        default:
+            return 0;
+    }
+}
+
+// Returns true if all the assignments to the variable in the expression
+// are integers.
+static int check_assign(const dp_ctx *c, const expr *ex, unsigned var)
+{
+    if( !ex || ex->type != et_tok )
+        return 1;
+    if( ex->tok == TOK_F_ASGN && ex->lft && ex->lft->type == et_var_number &&
+        ex->lft->var == var && !is_int_expr(c, ex->rgt, var) )
+        return 0;
+    return check_assign(c, ex->lft, var) && check_assign(c, ex->rgt, var);
+}
+
+// Returns true if the variable always holds an integer
+static int var_is_int(const dp_ctx *c, unsigned var)
+{
+    for(expr *ex = c->prog; ex; ex = ex->lft)
+    {
+        if( ex->type != et_stmt )
+            continue;
+        switch( ex->stmt )
+        {
+            case STMT_LET:
+            case STMT_LET_INV:
+                if( !check_assign(c, ex->rgt, var) )
+                    return 0;
+                break;
+            case STMT_GET:
+            case STMT_LOCATE:
+                // Read bytes
+                break;
+            case STMT_FOR:
+            {
+                // Integer start and step give integer values
+                expr *v, *start, *step;
+                if( !opt_for_parts(ex, &v, &start, 0, &step) )
+                    return 0;
+                if( v->var == var && (!is_int_expr(c, start, var) ||
+                                      (step && !is_int_expr(c, step, var))) )
+                    return 0;
+                break;
+            }
+            case STMT_ENTER:
+                return 0;
+            case STMT_INPUT:
+            case STMT_P_GET:
+            case STMT_READ:
+            case STMT_NOTE:
+            case STMT_STATUS:
+            case STMT_PROC:
+            case STMT_PROC_VAR:
+            case STMT_LBL_S:
+                // Can write other values
+                if( uses_var(ex->rgt, var) )
+                    return 0;
+                break;
+            default:
+                break;
+        }
+    }
+    return 1;
+}
+
+// Returns true if the address "b" is "a+1"
+static int next_addr(expr *a, expr *b)
+{
+    a = opt_strip_prn(a);
+    b = opt_strip_prn(b);
+    if( !a || !b )
+        return 0;
+    if( expr_is_cnum(a) && expr_is_cnum(b) )
+        return b->num == a->num + 1;
+    if( b->type != et_tok || b->tok != TOK_PLUS )
+        return 0;
+    if( (is_cnum(b->rgt, 1) && opt_expr_equal(b->lft, a)) ||
+        (is_cnum(b->lft, 1) && opt_expr_equal(b->rgt, a)) )
+        return 1;
+    // A+n and A+n+1, after constant folding
+    return a->type == et_tok && a->tok == TOK_PLUS && expr_is_cnum(a->rgt) &&
+           expr_is_cnum(b->rgt) && b->rgt->num == a->rgt->num + 1 &&
+           opt_expr_equal(a->lft, b->lft);
+}
+
+// Returns the PEEK node if the expression is "PEEK(X)"
+static expr *lo_peek(expr *ex)
+{
+    ex = opt_strip_prn(ex);
+    if( ex && ex->type == et_tok && ex->tok == TOK_PEEK && ex->rgt )
+        return ex;
+    return 0;
+}
+
+// Returns the PEEK node if the expression is "256*PEEK(X)" or "PEEK(X)*256"
+static expr *hi_peek(expr *ex)
+{
+    ex = opt_strip_prn(ex);
+    if( !ex || ex->type != et_tok || ex->tok != TOK_STAR )
+        return 0;
+    if( is_cnum(opt_strip_prn(ex->lft), 256) )
+        return lo_peek(ex->rgt);
+    if( is_cnum(opt_strip_prn(ex->rgt), 256) )
+        return lo_peek(ex->lft);
+    return 0;
+}
+
+// Returns the address of the DPEEK if "a+b" reads a 16 bit value
+static expr *match_peek(expr *a, expr *b)
+{
+    expr *lo = lo_peek(a), *hi = hi_peek(b);
+    if( !lo || !hi )
+    {
+        lo = lo_peek(b);
+        hi = hi_peek(a);
+    }
+    if( !lo || !hi || !next_addr(lo->rgt, hi->rgt) || has_side_effects(lo->rgt) )
+        return 0;
+    return lo->rgt;
+}
+
+static void report(dp_ctx *c, const expr *ex, int bytes, int time, const char *desc)
+{
+    info_print(expr_get_file_name(ex), expr_get_file_line(ex), "replacing %s.\n", desc);
+    remark("dpeek_dpoke", expr_get_file_name(ex), expr_get_file_line(ex), remark_applied,
+           bytes, time, "replaced %s", desc);
+    c->count ++;
+}
+
+static void do_peek(dp_ctx *c, expr *ex)
+{
+    if( !ex )
+        return;
+    do_peek(c, ex->lft);
+    do_peek(c, ex->rgt);
+    if( ex->type != et_tok || ex->tok != TOK_PLUS )
+        return;
+
+    // PEEK, PEEK, "*", "+", two pairs of parenthesis and the address
+    // plus one, at least 6 bytes.
+    int bytes = 6 + OPT_COST_NUM_BYTES;
+    int time = opt_cost_tok_time(TOK_PEEK) + opt_cost_tok_time(TOK_STAR) +
+               2 * opt_cost_tok_time(TOK_PLUS) - opt_cost_tok_time(TOK_DPEEK);
+    expr *addr = match_peek(ex->lft, ex->rgt);
+    if( addr )
+    {
+        report(c, ex, bytes, time, "two PEEK with DPEEK");
+        ex->tok = TOK_DPEEK;
+        ex->lft = 0;
+        ex->rgt = addr;
+        return;
+    }
+    // C+PEEK(A)+256*PEEK(A+1)
+    expr *l = ex->lft;
+    if( !l || l->type != et_tok || l->tok != TOK_PLUS )
+        return;
+    addr = match_peek(l->rgt, ex->rgt);
+    if( addr )
+    {
+        report(c, ex, bytes, time, "two PEEK with DPEEK");
+        ex->lft = l->lft;
+        ex->rgt = l;
+        l->tok = TOK_DPEEK;
+        l->lft = 0;
+        l->rgt = addr;
+    }
+}
+
+// Returns "V" if "lo" and "hi" are the low and high bytes of "V", or the
+// constant value if both are constants. "V" must always be an integer.
+static expr *match_bytes(const dp_ctx *c, expr *lo, expr *hi)
+{
+    lo = opt_strip_prn(lo);
+    hi = opt_strip_prn(hi);
+    if( !lo || !hi )
+        return 0;
+
+    if( expr_is_cnum(lo) && expr_is_cnum(hi) )
+    {
+        if( lo->num < 0 || lo->num > 255 || lo->num != floor(lo->num) ||
+            hi->num < 0 || hi->num > 255 || hi->num != floor(hi->num) )
+            return 0;
+        expr *n = expr_new_number(lo->mngr, lo->num + 256 * hi->num);
+        n->file_line = lo->file_line;
+        return n;
+    }
+
+    // High byte: INT(V/256) or V DIV 256
+    expr *v;
+    if( hi->type == et_tok && hi->tok == TOK_INT )
+    {
+        expr *d = opt_strip_prn(hi->rgt);
+        if( !d || d->type != et_tok || d->tok != TOK_SLASH || !is_cnum(opt_strip_prn(d->rgt), 256) )
+            return 0;
+        v = d->lft;
+    }
+    else if( hi->type == et_tok && hi->tok == TOK_DIV && is_cnum(opt_strip_prn(hi->rgt), 256) )
+        v = hi->lft;
+    else
+        return 0;
+    if( !is_simple(v) || !is_int_expr(c, v, -1) || lo->type != et_tok )
+        return 0;
+
+    // Low byte: V-256*H, V-H*256, V&255 or V MOD 256
+    switch( lo->tok )
+    {
+        case TOK_MINUS:
+        {
+            expr *m = opt_strip_prn(lo->rgt);
+            if( !opt_expr_equal(lo->lft, v) || !m || m->type != et_tok || m->tok != TOK_STAR )
+                return 0;
+            if( (is_cnum(opt_strip_prn(m->lft), 256) && opt_expr_equal(m->rgt, hi)) ||
+                (is_cnum(opt_strip_prn(m->rgt), 256) && opt_expr_equal(m->lft, hi)) )
+                return v;
+            return 0;
+        }
+        case TOK_ANDPER:
+            if( (is_cnum(opt_strip_prn(lo->rgt), 255) && opt_expr_equal(lo->lft, v)) ||
+                (is_cnum(opt_strip_prn(lo->lft), 255) && opt_expr_equal(lo->rgt, v)) )
+                return v;
+            return 0;
+        case TOK_MOD:
+            if( is_cnum(opt_strip_prn(lo->rgt), 256) && opt_expr_equal(lo->lft, v) )
+                return v;
+            return 0;
+        default:
+            return 0;
+    }
+}
+
+// Returns the next statement in the same line, skipping comments.
+static expr *next_stmt(expr *ex)
+{
+    for(ex = ex->lft; ex; ex = ex->lft)
+    {
+        if( ex->type == et_lnum && ex->num >= 0 )
+            return 0;
+        if( ex->type == et_stmt && !check_hidden(ex) )
+            return ex;
+    }
+    return 0;
+}
+
+static void do_poke(dp_ctx *c, expr *ex)
+{
+    expr *n = next_stmt(ex);
+    if( !n || n->stmt != STMT_POKE )
+        return;
+    expr *a = ex->rgt, *b = n->rgt;
+    if( !a || a->type != et_tok || a->tok != TOK_COMMA ||
+        !b || b->type != et_tok || b->tok != TOK_COMMA )
+        return;
+    // Low byte first or high byte first
+    if( !next_addr(a->lft, b->lft) )
+    {
+        expr *t = a;
+        a = b;
+        b = t;
+        if( !next_addr(a->lft, b->lft) )
+            return;
+    }
+    if( !is_simple(a->lft) )
+        return;
+    expr *v = match_bytes(c, a->rgt, b->rgt);
+    if( !v )
+        return;
+
+    // One statement and the address are removed
+    report(c, ex, OPT_COST_STMT_BYTES + OPT_COST_NUM_BYTES + 2, opt_cost_stmt_time(STMT_POKE),
+           "two POKE with DPOKE");
+    a->rgt = v;
+    ex->stmt = STMT_DPOKE;
+    ex->rgt = a;
+    const char *txt = "POKE replaced with DPOKE";
+    n->stmt = STMT_REM_HIDDEN;
+    n->rgt = expr_new_data(n->mngr, (const uint8_t *)txt, strlen(txt), 0);
+}
+
+int opt_dpeek_dpoke(expr *prog)
+{
+    // Only TurboBasic XL has DPEEK and DPOKE
+    if( !prog || parser_get_dialect() != parser_dialect_turbo )
+        return 0;
+
+    dp_ctx c;
+    c.prog = prog;
+    c.count = 0;
+
+    for(expr *ex = prog; ex; ex = ex->lft)
+    {
+        if( ex->type != et_stmt )
+            continue;
+        do_peek(&c, ex->rgt);
+        if( ex->stmt == STMT_POKE )
+            do_poke(&c, ex);
+    }
+
+    if( c.count )
+        info_print(expr_get_file_name(prog), 0, "replaced %d PEEK and POKE pairs.\n", c.count);
+    return 0;
+}
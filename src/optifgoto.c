@@ -39,6 +39,11 @@ static int check_goto(expr *ex)
     return ex->type == et_stmt && ex->stmt == STMT_GOTO;
 }
 
+static int check_hidden(expr *ex)
+{
+    return ex && ex->type == et_stmt && ex->stmt == STMT_REM_HIDDEN;
+}
+
 static int check_then(expr *ex)
 {
     return ex && ex->type == et_tok && ex->tok == TOK_THEN;
@@ -51,7 +56,7 @@ static int expr_is_cnum(expr *ex)
 
 static int do_check_stmt(expr *ex, int multiline)
 {
-    expr *gto;
+    expr *gto, *endif;
     assert(ex && ex->type == et_stmt);
 
     if(!multiline && ex->stmt == STMT_IF_MULTILINE)
@@ -181,16 +186,19 @@ static int do_check_stmt(expr *ex, int multiline)
             if(get_output_type() != out_binary && !expr_is_cnum(gto->rgt))
                 return 0;
             // Ok, we have our GOTO, check that there are no more statements
-            // in the IF up to the ENDIF
-            if(!check_endif(gto->lft))
+            // in the IF up to the ENDIF, skipping removed statements
+            endif = gto->lft;
+            while(check_hidden(endif))
+                endif = endif->lft;
+            if(!endif || endif->type != et_stmt || !check_endif(endif))
             {
                 warn("Statements in IF after GOTO, probably ignored.");
                 return 1;
             }
             // Check ENDIF is ok
-            assert(!gto->lft->rgt);
+            assert(!endif->rgt);
             // Ok, we can replace our expression
-            ex->lft = gto->lft->lft;
+            ex->lft = endif->lft;
             // Change to IF-NUMBER
             ex->stmt = STMT_IF_NUMBER;
             if(check_then(ex->rgt))
@@ -18,10 +18,25 @@
 
 #include "optimize.h"
 #include "expr.h"
+#include "optbool.h"
 #include "optconst.h"
 #include "optlinenum.h"
 #include "optconstvar.h"
+#include "optcost.h"
+#include "optcse.h"
+#include "optdpeek.h"
 #include "optifgoto.h"
+#include "optinline.h"
+#include "optlicm.h"
+#include "optmove.h"
+#include "optongoto.h"
+#include "optparen.h"
+#include "optplace.h"
+#include "optprop.h"
+#include "optstrength.h"
+#include "opttailcall.h"
+#include "optunreach.h"
+#include "optunroll.h"
 #include "optrmvars.h"
 #include "vars.h"
 #include "program.h"
@@ -42,6 +57,25 @@ static struct optimization_options {
     { OPT_FIXED_VARS, "fixed_vars",      "Remove variables with constant values" },
     { OPT_THEN_GOTO,  "then_goto",       "Convert THEN GOTO to THEN alone" },
     { OPT_IF_GOTO,    "if_goto",         "Also convert IF/GOTO/ENDIF to IF/THEN alone (TBXL)" },
+    { OPT_PROPAGATE,  "propagate",       "Propagate known variable values across statements" },
+    { OPT_DEAD_CODE,  "dead_code",       "Remove statements that can't be reached" },
+    { OPT_DEAD_PROCS, "dead_procs",      "Also remove PROCs and subroutines never called" },
+    { OPT_CSE,        "cse",             "Store repeated expressions in variables (faster)" },
+    { OPT_INVARIANTS, "invariants",      "Move expressions that don't change out of loops" },
+    { OPT_INV_SPEED,  "invariants_speed","Also move invariants that make the program bigger" },
+    { OPT_VAR_ORDER,  "var_order",       "Give smaller numbers to variables used more" },
+    { OPT_SIZE,       "size",            "Only do transformations that make the program smaller" },
+    { OPT_SPEED,      "speed",           "Do transformations that make the program faster" },
+    { OPT_PLACEMENT,  "placement",       "Move lines jumped to more often to the start" },
+    { OPT_ON_GOTO,    "on_goto",         "Replace chains of IF V=1 THEN .. with ON V GOTO" },
+    { OPT_TAIL_CALLS, "tail_calls",      "Replace GOSUB before RETURN with GOTO" },
+    { OPT_STRENGTH,   "strength",        "Replace slow operations with faster ones, as X^2 with X*X" },
+    { OPT_INLINE,     "inline_procs",    "Replace calls to small PROCs or called once with the body" },
+    { OPT_MOVE_LOOPS, "move_loops",      "Replace loops copying or filling memory with MOVE (TBXL only)" },
+    { OPT_DPEEK,      "dpeek_dpoke",     "Replace pairs of PEEK and POKE with DPEEK and DPOKE (TBXL only)" },
+    { OPT_BOOLEAN,    "boolean",         "Simplify logical operations and comparisons" },
+    { OPT_UNROLL,     "unroll",          "Unroll FOR loops with few iterations (faster)" },
+    { OPT_PARENS,     "parens",          "Remove parenthesis not needed by operator precedence" },
     { 0, 0, 0 }
 };
 
@@ -72,19 +106,52 @@ void optimize_list_options(void)
     fprintf(stderr, "\nOptions with '*' are enabled with the '-O' option alone.\n");
 }
 
+// Returns the objective of the optimizations, balanced unless only one
+// of "size" or "speed" is given.
+static enum opt_objective optimize_objective(int level)
+{
+    if( (level & OPT_SIZE) && !(level & OPT_SPEED) )
+        return opt_obj_size;
+    if( (level & OPT_SPEED) && !(level & OPT_SIZE) )
+        return opt_obj_speed;
+    return opt_obj_balanced;
+}
+
 int optimize_program(program *pgm, int level)
 {
     // Convert program to expression tree
     expr *ex = pgm_get_expr(pgm);
     int err = 0;
-
+    enum opt_objective obj = optimize_objective(level);
 
     // Optimize:
     err = opt_replace_defs(ex);
 
+    if( level & OPT_PARENS )
+        err |= opt_remove_parens(ex);
+
     if( level & OPT_CONST_FOLD )
         err |= opt_constprop(ex);
 
+    // Inline before the propagation, so the values of the parameters are
+    // propagated to the PROC body.
+    if( level & OPT_INLINE )
+        err |= opt_inline_procs(ex, obj);
+
+    // Propagation needs constant folding to simplify the result
+    if( (level & OPT_PROPAGATE) && (level & OPT_CONST_FOLD) )
+        err |= opt_propagate(ex, obj);
+
+    if( level & OPT_BOOLEAN )
+        err |= opt_simplify_bool(ex);
+
+    // Before the strength reduction changes the INT(V/256)
+    if( level & OPT_DPEEK )
+        err |= opt_dpeek_dpoke(ex);
+
+    if( level & OPT_STRENGTH )
+        err |= opt_strength_reduce(ex, obj);
+
     if( level & OPT_COMMUTE )
         err |= opt_commute(ex);
 
@@ -99,6 +166,31 @@ int optimize_program(program *pgm, int level)
         }
     }
 
+    if( level & OPT_MOVE_LOOPS )
+        err |= opt_move_loops(ex, obj);
+
+    // After the MOVE loops, as those are faster than the unrolled loop
+    if( level & OPT_UNROLL )
+        err |= opt_unroll_loops(ex, obj);
+
+    if( level & (OPT_DEAD_CODE | OPT_DEAD_PROCS) )
+        err |= opt_remove_unreachable(ex, level & OPT_DEAD_PROCS);
+
+    if( level & (OPT_INVARIANTS | OPT_INV_SPEED) )
+        err |= opt_move_invariants(ex, (level & OPT_INV_SPEED) ? opt_obj_speed : obj);
+
+    if( level & OPT_CSE )
+        err |= opt_cse(ex, obj);
+
+    if( level & OPT_TAIL_CALLS )
+        err |= opt_tail_calls(ex);
+
+    if( level & OPT_ON_GOTO )
+        err |= opt_on_goto(ex, obj);
+
+    if( level & OPT_PLACEMENT )
+        err |= opt_place_hot(ex);
+
     if( level & OPT_LINE_NUM )
         err |= opt_remove_line_num(ex);
 
@@ -108,11 +200,14 @@ int optimize_program(program *pgm, int level)
     err |= opt_remove_unused_vars(ex);
 
     if( level & OPT_CONST_VARS )
-        err |= opt_replace_const(ex);
+        err |= opt_replace_const(ex, obj);
 
     if( level & OPT_IF_GOTO || level & OPT_THEN_GOTO )
         err |= opt_convert_then_goto(ex, level & OPT_IF_GOTO);
 
+    if( level & OPT_VAR_ORDER )
+        err |= opt_sort_vars(ex);
+
     pgm_set_expr(pgm, ex);
     return err;
 }
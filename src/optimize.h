@@ -27,7 +27,26 @@ enum optimize_levels {
     OPT_CONST_VARS = 16,
     OPT_FIXED_VARS = 32,
     OPT_THEN_GOTO  = 64,
-    OPT_IF_GOTO    = 128
+    OPT_IF_GOTO    = 128,
+    OPT_PROPAGATE  = 256,
+    OPT_DEAD_CODE  = 512,
+    OPT_DEAD_PROCS = 1024,
+    OPT_CSE        = 2048,
+    OPT_INVARIANTS = 4096,
+    OPT_INV_SPEED  = 8192,
+    OPT_VAR_ORDER  = 16384,
+    OPT_SIZE       = 32768,
+    OPT_SPEED      = 65536,
+    OPT_PLACEMENT  = 131072,
+    OPT_STRENGTH   = 262144,
+    OPT_ON_GOTO    = 524288,
+    OPT_TAIL_CALLS = 1048576,
+    OPT_INLINE     = 2097152,
+    OPT_MOVE_LOOPS = 4194304,
+    OPT_DPEEK      = 8388608,
+    OPT_BOOLEAN    = 16777216,
+    OPT_UNROLL     = 33554432,
+    OPT_PARENS     = 67108864
 };
 
 // Returns the "standard" optimizations
@@ -0,0 +1,347 @@
+/*
+ *  Basic Parser - TurboBasic XL compatible parsing and transformation tool.
+ *  Copyright (C) 2015 Daniel Serpell
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "optinline.h"
+#include "expr.h"
+#include "basexpr.h"
+#include "dbg.h"
+#include "optlinenum.h"
+#include "program.h"
+#include "remarks.h"
+#include "vars.h"
+#include "optutil.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Replaces "EXEC P" with a copy of the statements of the PROC, saving the
+// search of the PROC, the stack entry and the ENDPROC. This is done for
+// PROCs called only once, and for PROCs with a body smaller than the call,
+// or if the cost model accepts the bigger program. When all the calls are
+// replaced, the PROC is removed.
+//
+// The parameters of the PROC are already assigned before the EXEC by
+// convert_proc_exec, so only the body must be copied. The body is joined
+// to the line of the call, so it can't contain statements that depend on
+// the end of the line (IF/THEN), jumps, labels or statements that use the
+// stack entry of the call.
+
+typedef struct {
+    expr *proc;         // PROC statement
+    expr *end;          // ENDPROC statement
+    unsigned label;     // PROC label
+    int bytes;          // Bytes of the statements copied
+    int nstmt;          // Number of statements copied
+} in_proc;
+
+typedef struct {
+    expr *prog;
+    vars *v;
+    enum opt_objective obj;
+    lnum_targets *targets;  // Line numbers that are target of jumps
+    int count;          // Number of calls replaced
+} in_ctx;
+
+static int is_label(const expr *ex, unsigned label)
+{
+    return ex && ex->type == et_var_label && ex->var == label;
+}
+
+// Statements inside the PROC that are not copied to the calls
+static int not_copied(const expr *ex)
+{
+    return ex->stmt == STMT_REM || ex->stmt == STMT_REM_ ||
+           ex->stmt == STMT_REM_HIDDEN || ex->stmt == STMT_DATA;
+}
+
+// Searches the ENDPROC and checks if the statements can be copied to the
+// calls, returns the reason if not.
+static const char *check_body(const in_ctx *c, in_proc *p)
+{
+    int loops = 0, ifs = 0;
+    p->bytes = 0;
+    p->nstmt = 0;
+    for(expr *ex = p->proc->lft; ex; ex = ex->lft)
+    {
+        if( ex->type == et_lnum )
+        {
+            if( opt_is_target(c->targets, ex) )
+                return "a line inside the PROC is the target of a jump";
+            continue;
+        }
+        if( ex->type != et_stmt )
+            continue;
+        switch( ex->stmt )
+        {
+            case STMT_ENDPROC:
+                if( loops || ifs )
+                    return "ENDPROC inside a loop or IF";
+                p->end = ex;
+                return 0;
+            case STMT_PROC:
+            case STMT_PROC_VAR:
+                return "PROC without ENDPROC";
+            case STMT_LBL_S:
+                return "PROC contains a label";
+            case STMT_IF:
+            case STMT_IF_THEN:
+            case STMT_IF_NUMBER:
+                return "PROC contains IF/THEN";
+            case STMT_GOTO:
+            case STMT_GO_TO:
+            case STMT_GO_S:
+            case STMT_ON:
+                return "PROC contains a jump";
+            case STMT_RETURN:
+            case STMT_POP:
+                return "PROC uses the stack";
+            case STMT_EXEC:
+                if( is_label(ex->rgt, p->label) )
+                    return "PROC is recursive";
+                break;
+            case STMT_IF_MULTILINE:
+                ifs ++;
+                break;
+            case STMT_ELSE:
+            case STMT_ENDIF:
+                if( !ifs )
+                    return "PROC closes an IF of the caller";
+                if( ex->stmt == STMT_ENDIF )
+                    ifs --;
+                break;
+            case STMT_FOR:
+            case STMT_WHILE:
+            case STMT_REPEAT:
+            case STMT_DO:
+                loops ++;
+                break;
+            case STMT_NEXT:
+            case STMT_WEND:
+            case STMT_UNTIL:
+            case STMT_LOOP:
+            case STMT_EXIT:
+                if( !loops )
+                    return "PROC closes a loop of the caller";
+                if( ex->stmt != STMT_EXIT )
+                    loops --;
+                break;
+            default:
+                break;
+        }
+        if( !not_copied(ex) )
+        {
+            // Statement length and statement tokens
+            p->bytes += 1 + expr_get_bas_len(ex);
+            p->nstmt ++;
+        }
+    }
+    return "PROC without ENDPROC";
+}
+
+// Counts the calls to the PROC and the time saved by replacing them, and
+// the references from ON/EXEC that can't be replaced.
+static int count_calls(const in_ctx *c, const in_proc *p, int *on_refs, int *time)
+{
+    int calls = 0;
+    int t = opt_cost_stmt_time(STMT_EXEC) + opt_cost_stmt_time(STMT_ENDPROC);
+    *on_refs = 0;
+    *time = 0;
+    for(const expr *ex = c->prog; ex; ex = ex->lft)
+    {
+        if( ex->type != et_stmt )
+            continue;
+        if( ex->stmt == STMT_EXEC && is_label(ex->rgt, p->label) )
+        {
+            calls ++;
+            *time += opt_cost_hot_time(ex, t);
+        }
+        else if( ex->stmt == STMT_ON && ex->rgt && ex->rgt->type == et_tok &&
+                 ex->rgt->tok == TOK_ON_EXEC )
+        {
+            const expr *l = ex->rgt->rgt;
+            for(; l && l->type == et_tok && l->tok == TOK_COMMA; l = l->lft)
+                if( is_label(l->rgt, p->label) )
+                    (*on_refs) ++;
+            if( is_label(l, p->label) )
+                (*on_refs) ++;
+        }
+    }
+    return calls;
+}
+
+// Returns true if "add" bytes and the statements of the PROC can be added
+// to the line starting at "line" without splitting it.
+static int line_fits(const expr *line, const in_proc *p, unsigned add)
+{
+    unsigned maxlen = 255;
+    for(const expr *ex = p->proc->lft; ex != p->end; ex = ex->lft)
+    {
+        if( ex->type != et_stmt || not_copied(ex) )
+            continue;
+        unsigned m = expr_get_bas_maxlen(ex);
+        if( m < maxlen )
+            maxlen = m;
+    }
+    return opt_line_fits(line, add, maxlen);
+}
+
+// Replace the EXEC statement with a copy of the PROC statements
+static void inline_call(const in_proc *p, expr *call)
+{
+    expr *next = call->lft;
+    expr *last = 0;
+    for(const expr *ex = p->proc->lft; ex != p->end; ex = ex->lft)
+    {
+        if( ex->type != et_stmt || not_copied(ex) )
+            continue;
+        if( !last )
+        {
+            // Reuse the EXEC node for the first statement
+            call->stmt = ex->stmt;
+            call->rgt = expr_copy(call->mngr, ex->rgt);
+            last = call;
+        }
+        else
+        {
+            expr *n = expr_new_stmt(call->mngr, last, expr_copy(call->mngr, ex->rgt), ex->stmt);
+            n->file_line = call->file_line;
+            last = n;
+        }
+    }
+    if( !last )
+    {
+        const char *txt = "inlined EXEC";
+        call->stmt = STMT_REM_HIDDEN;
+        call->rgt = expr_new_data(call->mngr, (const uint8_t *)txt, strlen(txt), 0);
+        last = call;
+    }
+    last->lft = next;
+}
+
+// Replace the PROC statements with comments, keeping DATA
+static void remove_proc(const in_proc *p)
+{
+    const char *txt = "inlined PROC";
+    for(expr *ex = p->proc; ex != p->end->lft; ex = ex->lft)
+    {
+        if( ex->type != et_stmt || ex->stmt == STMT_DATA || ex->stmt == STMT_REM ||
+            ex->stmt == STMT_REM_ || ex->stmt == STMT_REM_HIDDEN )
+            continue;
+        ex->stmt = STMT_REM_HIDDEN;
+        ex->rgt = expr_new_data(ex->mngr, (const uint8_t *)txt, strlen(txt), 0);
+    }
+}
+
+static void do_inline(in_ctx *c, in_proc *p)
+{
+    const char *name = vars_get_long_name(c->v, p->label);
+    const char *fname = expr_get_file_name(p->proc);
+    int fline = expr_get_file_line(p->proc);
+
+    const char *err = check_body(c, p);
+    if( err )
+    {
+        remark("inline_procs", fname, fline, remark_missed, 0, 0,
+               "PROC %s not inlined: %s", name, err);
+        return;
+    }
+
+    int on_refs, time;
+    int calls = count_calls(c, p, &on_refs, &time);
+    if( !calls )
+        return;
+
+    // The EXEC is replaced with the body, the PROC, label and ENDPROC are
+    // removed if all the calls are replaced.
+    int call_bytes = OPT_COST_STMT_BYTES + opt_cost_var_bytes(0);
+    int proc_bytes = 2 * OPT_COST_STMT_BYTES + opt_cost_var_bytes(0) + p->bytes;
+    int bytes = calls * (p->bytes - call_bytes) - (on_refs ? 0 : proc_bytes);
+    if( !opt_cost_accept(c->obj, bytes, time) )
+    {
+        remark("inline_procs", fname, fline, remark_missed, -bytes, time,
+               "PROC %s with %d calls not inlined: not profitable", name, calls);
+        return;
+    }
+
+    int done = 0;
+    expr *line = 0;
+    for(expr *ex = c->prog; ex; ex = ex->lft)
+    {
+        if( ex->type == et_lnum )
+            line = ex;
+        if( ex->type != et_stmt || ex->stmt != STMT_EXEC || !is_label(ex->rgt, p->label) )
+            continue;
+        if( !line_fits(line, p, p->bytes - call_bytes) )
+        {
+            remark("inline_procs", expr_get_file_name(ex), expr_get_file_line(ex),
+                   remark_missed, 0, 0, "EXEC %s not inlined: line too long", name);
+            continue;
+        }
+        info_print(expr_get_file_name(ex), expr_get_file_line(ex),
+                   "inlining PROC %s, %d statements.\n", name, p->nstmt);
+        remark("inline_procs", expr_get_file_name(ex), expr_get_file_line(ex), remark_applied,
+               call_bytes - p->bytes, opt_cost_hot_time(ex, opt_cost_stmt_time(STMT_EXEC) +
+                                                        opt_cost_stmt_time(STMT_ENDPROC)),
+               "inlined PROC %s", name);
+        inline_call(p, ex);
+        done ++;
+    }
+    c->count += done;
+
+    if( done == calls && !on_refs )
+    {
+        info_print(fname, fline, "removing inlined PROC %s.\n", name);
+        remark("inline_procs", fname, fline, remark_applied, proc_bytes, 0,
+               "removed inlined PROC %s", name);
+        remove_proc(p);
+    }
+}
+
+int opt_inline_procs(expr *prog, enum opt_objective obj)
+{
+    if( !prog )
+        return 0;
+
+    in_ctx c;
+    c.prog = prog;
+    c.v = pgm_get_vars( expr_get_program(prog) );
+    c.obj = obj;
+    c.targets = opt_targets_new();
+    c.count = 0;
+
+    opt_search_targets(c.targets, prog);
+
+    for(expr *ex = prog; ex; ex = ex->lft)
+    {
+        if( ex->type != et_stmt || ex->stmt != STMT_PROC ||
+            !ex->rgt || ex->rgt->type != et_var_label )
+            continue;
+        in_proc p;
+        p.proc = ex;
+        p.end = 0;
+        p.label = ex->rgt->var;
+        do_inline(&c, &p);
+    }
+
+    if( c.count )
+        info_print(expr_get_file_name(prog), 0, "inlined %d PROC calls.\n", c.count);
+
+    opt_targets_free(c.targets);
+    return 0;
+}
@@ -0,0 +1,660 @@
+/*
+ *  Basic Parser - TurboBasic XL compatible parsing and transformation tool.
+ *  Copyright (C) 2015 Daniel Serpell
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "optlicm.h"
+#include "expr.h"
+#include "vars.h"
+#include "dbg.h"
+#include "dmem.h"
+#include "darray.h"
+#include "parser.h"
+#include "program.h"
+#include "optcost.h"
+#include "optlinenum.h"
+#include "remarks.h"
+#include "optutil.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Maximum number of expressions tracked in one loop
+#define LICM_MAX_ENTRIES     256
+
+// One invariant expression found in the loop
+typedef struct {
+    expr *key;      // First occurrence, without parenthesis
+    int count;      // Number of occurrences
+    int weight;     // Estimated time to evaluate the expression
+    int bytes;      // Size of the expression in the tokenized program
+    int fail;       // Expression can produce an error
+    int first;      // One occurrence is always executed, before any effect
+    int done;       // Already processed
+} licm_entry;
+
+// Location of each occurrence of an expression
+typedef struct {
+    unsigned entry;
+    expr *node;
+} licm_occur;
+
+// A loop with variables moved outside
+typedef struct {
+    expr *close;    // Statement closing the loop
+    unsigned start; // First variable used in the "active" list
+} licm_loop;
+
+typedef darray(licm_entry) licm_entry_list;
+typedef darray(licm_occur) licm_occur_list;
+typedef darray(licm_loop) licm_loop_list;
+typedef darray(int) licm_temp_list;
+
+typedef struct {
+    vars *v;
+    lnum_targets *targets;
+    enum opt_objective obj; // Optimization objective
+    const expr *loop_end;   // Statement closing the current loop
+    uint8_t *written;       // Variables written inside the loop
+    unsigned nwritten;      // Size of "written"
+    int clobber;            // Memory is written inside the loop
+    licm_entry_list *lst;   // Invariant expressions in current loop
+    licm_occur_list *occ;   // Occurrences of the expressions
+    licm_temp_list *temps;  // Temporary variables created
+    licm_temp_list *active; // Temporary variables in use by outer loops
+    licm_loop_list *loops;  // Loops with temporary variables in use
+    unsigned nvar;          // Current number of variables
+    unsigned max_vars;      // Maximum number of variables
+    int num;                // Number of expressions moved
+} licm_ctx;
+
+static int expr_is_cnum(const expr *ex)
+{
+    return ex && (ex->type == et_c_number || ex->type == et_c_hexnumber);
+}
+
+// Returns the estimated time to evaluate the token, or -1 if the token
+// can't be moved. Sets "mem" if the result depends on the memory contents
+// and "fail" if the operation can produce an error.
+static int tok_weight(const expr *ex, int *mem, int *fail)
+{
+    switch( ex->tok )
+    {
+        case TOK_SLASH:
+        case TOK_DIV:
+        case TOK_MOD:
+            // Division by zero
+            if( !expr_is_cnum(ex->rgt) || ex->rgt->num == 0 )
+                *fail = 1;
+            break;
+        case TOK_SQR:
+        case TOK_EXP:
+        case TOK_LOG:
+        case TOK_CLOG:
+        case TOK_CARET:
+        // Overflow
+        case TOK_PLUS:
+        case TOK_MINUS:
+        case TOK_STAR:
+        // Operands out of the 0 to 65535 range
+        case TOK_ANDPER:
+        case TOK_EXCLAM:
+        case TOK_EXOR:
+            *fail = 1;
+            break;
+        case TOK_ATN:
+        case TOK_COS:
+        case TOK_SIN:
+            // Depends on the DEG/RAD mode, stored in memory
+            *mem = 1;
+            break;
+        case TOK_PEEK:
+        case TOK_DPEEK:
+            // Only constant addresses that are not modified by the OS
+            if( !expr_is_cnum(ex->rgt) || opt_volatile_addr(ex->rgt->num) ||
+                (ex->tok == TOK_DPEEK && opt_volatile_addr(ex->rgt->num + 1)) )
+                return -1;
+            *mem = 1;
+            break;
+        default:
+            break;
+    }
+    return opt_cost_tok_time(ex->tok);
+}
+
+// Returns true if the expression can be moved outside of the current loop,
+// accumulating the estimated time to evaluate it.
+static int invariant_expr(const licm_ctx *c, const expr *ex, int *w, int *fail)
+{
+    int mem = 0;
+    switch( ex->type )
+    {
+        case et_c_number:
+        case et_c_hexnumber:
+            return 1;
+        case et_var_number:
+            return ex->var >= c->nwritten || !c->written[ex->var];
+        case et_tok:
+            break;
+        default:
+            return 0;
+    }
+    int tw = tok_weight(ex, &mem, fail);
+    if( tw < 0 || (mem && c->clobber) )
+        return 0;
+    *w += tw;
+    if( ex->lft && !invariant_expr(c, ex->lft, w, fail) )
+        return 0;
+    if( ex->rgt && !invariant_expr(c, ex->rgt, w, fail) )
+        return 0;
+    return 1;
+}
+
+// Returns the statement closing a loop
+static enum enum_statements loop_close(enum enum_statements stmt)
+{
+    switch( stmt )
+    {
+        case STMT_FOR:    return STMT_NEXT;
+        case STMT_WHILE:  return STMT_WEND;
+        case STMT_REPEAT: return STMT_UNTIL;
+        case STMT_DO:     return STMT_LOOP;
+        default:          return stmt;
+    }
+}
+
+static int is_loop_var(expr *ex, const expr *var)
+{
+    if( !var )
+        return 1;
+    if( ex->stmt == STMT_FOR )
+    {
+        expr *v = opt_for_var(ex);
+        return v && v->var == var->var;
+    }
+    return ex->rgt && ex->rgt->type == et_var_number && ex->rgt->var == var->var;
+}
+
+static void write_var(licm_ctx *c, unsigned id)
+{
+    if( id < c->nwritten )
+        c->written[id] = 1;
+}
+
+static void write_vars(licm_ctx *c, const expr *ex)
+{
+    if( !ex )
+        return;
+    if( ex->type == et_var_number )
+        write_var(c, ex->var);
+    write_vars(c, ex->lft);
+    write_vars(c, ex->rgt);
+}
+
+// Searches the end of the loop and all the variables written inside.
+// Returns NULL if the loop can be entered from other places, calls other
+// code or the end can't be determined.
+static expr *loop_scan(licm_ctx *c, expr *head)
+{
+    enum enum_statements close = loop_close(head->stmt);
+    const expr *var = head->stmt == STMT_FOR ? opt_for_var(head) : 0;
+    int depth = 0, ifdepth = 0;
+
+    memset(c->written, 0, c->nwritten);
+    c->clobber = 0;
+
+    if( head->stmt == STMT_FOR )
+    {
+        if( !var )
+            return 0;
+        write_var(c, var->var);
+    }
+
+    for(expr *ex = head->lft; ex; ex = ex->lft)
+    {
+        if( ex->type == et_lnum )
+        {
+            if( opt_is_target(c->targets, ex) )
+                return 0;
+            continue;
+        }
+        if( ex->type != et_stmt )
+            continue;
+
+        if( opt_has_usr(ex->rgt) )
+            return 0;
+
+        if( ex->stmt == head->stmt && is_loop_var(ex, var) )
+            depth ++;
+        else if( ex->stmt == close && is_loop_var(ex, var) )
+        {
+            if( !depth )
+                return ifdepth ? 0 : ex;
+            depth --;
+        }
+
+        switch( opt_stmt_kind(ex->stmt) )
+        {
+            case opt_sk_none:
+            case opt_sk_last:
+                break;
+            case opt_sk_read:
+                if( ex->stmt == STMT_IF_THEN || ex->stmt == STMT_IF_MULTILINE )
+                    ifdepth ++;
+                break;
+            case opt_sk_clobber:
+                c->clobber = 1;
+                break;
+            case opt_sk_assign:
+                if( ex->rgt && ex->rgt->type == et_tok && ex->rgt->lft &&
+                    ex->rgt->lft->type == et_var_number )
+                    write_var(c, ex->rgt->lft->var);
+                else
+                {
+                    write_vars(c, ex->rgt);
+                    c->clobber = 1;
+                }
+                break;
+            case opt_sk_write:
+                write_vars(c, ex->rgt);
+                c->clobber = 1;
+                break;
+            case opt_sk_block:
+                if( ex->stmt == STMT_ENDIF || ex->stmt == STMT_ENDIF_INVISIBLE )
+                    ifdepth --;
+                else if( ex->stmt == STMT_FOR )
+                {
+                    expr *v = opt_for_var(ex);
+                    if( !v )
+                        return 0;
+                    write_var(c, v->var);
+                }
+                else if( ex->stmt == STMT_NEXT )
+                    write_vars(c, ex->rgt);
+                break;
+            case opt_sk_call:
+                return 0;
+        }
+    }
+    // End of loop not found
+    return 0;
+}
+
+static void add_occurrence(licm_ctx *c, expr *node, expr *key, int w, int fail, int first)
+{
+    licm_occur o;
+    o.node = node;
+    for(o.entry = 0; o.entry < darray_len(c->lst); o.entry++)
+    {
+        licm_entry *e = &darray_i(c->lst, o.entry);
+        if( opt_expr_equal(e->key, key) )
+        {
+            e->count ++;
+            e->first |= first;
+            darray_add(c->occ, o);
+            return;
+        }
+    }
+    if( darray_len(c->lst) >= LICM_MAX_ENTRIES )
+        return;
+
+    licm_entry e;
+    e.key = key;
+    e.count = 1;
+    e.weight = w;
+    e.bytes = opt_cost_expr_bytes(key);
+    e.fail = fail;
+    e.first = first;
+    e.done = 0;
+    darray_add(c->lst, e);
+    darray_add(c->occ, o);
+}
+
+// Adds the biggest invariant expressions read by the statement
+static void collect(licm_ctx *c, expr *ex, int first)
+{
+    if( !ex )
+        return;
+    expr *k = opt_strip_prn(ex);
+    int w = 0, fail = 0;
+    if( k->type == et_tok && invariant_expr(c, k, &w, &fail) && w > 0 )
+    {
+        add_occurrence(c, ex, k, w, fail, first);
+        return;
+    }
+    collect(c, k->lft, first);
+    collect(c, k->rgt, first);
+}
+
+// Adds all invariant expressions evaluated on each iteration of the loop.
+// Expressions are marked "first" if evaluated at each iteration before any
+// condition or statement with visible effects.
+static void collect_loop(licm_ctx *c, expr *head, expr *close)
+{
+    darray_len(c->lst) = 0;
+    darray_len(c->occ) = 0;
+
+    // WHILE condition is evaluated on each iteration, the body can be skipped
+    int first = 1;
+    if( head->stmt == STMT_WHILE )
+    {
+        collect(c, head->rgt, 1);
+        first = 0;
+    }
+
+    for(expr *ex = head->lft; ex && ex != close; ex = ex->lft)
+    {
+        if( ex->type != et_stmt )
+            continue;
+        switch( opt_stmt_kind(ex->stmt) )
+        {
+            case opt_sk_none:
+                break;
+            case opt_sk_read:
+            case opt_sk_clobber:
+            case opt_sk_last:
+                collect(c, ex->rgt, first);
+                first = 0;
+                break;
+            case opt_sk_assign:
+            {
+                expr *a = ex->rgt;
+                if( a && a->type == et_tok && a->lft )
+                {
+                    collect(c, a->rgt, first);
+                    if( a->lft->type == et_tok )
+                        collect(c, a->lft->rgt, first);
+                }
+                if( !a || !a->lft || a->lft->type != et_var_number )
+                    first = 0;
+                break;
+            }
+            case opt_sk_block:
+                // Start, limit and step of inner loops
+                if( ex->stmt == STMT_FOR || ex->stmt == STMT_WHILE || ex->stmt == STMT_UNTIL )
+                    collect(c, ex->rgt, first);
+                first = 0;
+                break;
+            case opt_sk_write:
+            case opt_sk_call:
+                first = 0;
+                break;
+        }
+    }
+
+    if( close->stmt == STMT_UNTIL )
+        collect(c, close->rgt, first);
+}
+
+static int temp_active(licm_ctx *c, int id)
+{
+    for(unsigned i = 0; i < darray_len(c->active); i++)
+        if( darray_i(c->active, i) == id )
+            return 1;
+    return 0;
+}
+
+// Returns a temporary variable not in use by outer loops, or -1 if a new
+// variable is needed.
+static int free_temp(licm_ctx *c)
+{
+    for(unsigned i = 0; i < darray_len(c->temps); i++)
+        if( !temp_active(c, darray_i(c->temps, i)) )
+            return darray_i(c->temps, i);
+    return -1;
+}
+
+static int new_temp(licm_ctx *c, const char *fname, int fline)
+{
+    char name[64];
+    // Skip names already used in the program
+    for(unsigned i = darray_len(c->temps); ; i++)
+    {
+        sprintf(name, "__h%u", i);
+        if( vars_search(c->v, name, vtFloat) < 0 )
+            break;
+    }
+    int id = vars_new_var(c->v, name, vtFloat, fname, fline);
+    darray_add(c->temps, id);
+    c->nvar ++;
+    return id;
+}
+
+static void set_var(expr *ex, int id)
+{
+    ex->type = et_var_number;
+    ex->var = id;
+    ex->lft = 0;
+    ex->rgt = 0;
+}
+
+// Calculates the gain in speed on each iteration and the bytes added by
+// moving the expression. Returns NULL if the expression can be moved, or
+// the reason.
+static const char *entry_gain(licm_ctx *c, const licm_entry *e, const expr *line,
+                              int *gain, int *bytes)
+{
+    int tmp = free_temp(c);
+    int vc, slot = 0;
+    *gain = *bytes = 0;
+    if( tmp < 0 )
+    {
+        if( c->nvar >= c->max_vars )
+            return "no free variables";
+        vc = opt_cost_var_bytes(c->nvar);
+        slot = OPT_COST_VAR_SLOT_BYTES;
+    }
+    else
+        vc = opt_cost_var_bytes(tmp);
+
+    // Expressions that can fail are only evaluated before the loop if
+    // they would be evaluated anyway at the first iteration.
+    if( e->fail && !e->first )
+        return "can produce an error and is not always evaluated";
+
+    // Assignment statement: statement length, token, variable, "=",
+    // expression and end.
+    int let_bytes = OPT_COST_LET_BYTES + vc + e->bytes;
+    if( !opt_line_fits(line, let_bytes, 255) )
+        return "line of the loop start too long";
+
+    // The time is saved on each iteration, executing the loop end
+    *gain = opt_cost_hot_time(c->loop_end, e->count * e->weight);
+    *bytes = slot + let_bytes - e->count * (e->bytes - vc);
+    if( *gain <= 0 || !opt_cost_accept(c->obj, *bytes, *gain) )
+        return "not profitable";
+    return 0;
+}
+
+// Moves the expression to a temporary variable assigned before the loop
+// head, returns the new position of the loop head.
+static expr *move_entry(licm_ctx *c, unsigned n, expr *head, int gain, int bytes)
+{
+    licm_entry *e = &darray_i(c->lst, n);
+    expr_mngr *m = head->mngr;
+
+    int tmp = free_temp(c);
+    if( tmp < 0 )
+        tmp = new_temp(c, expr_get_file_name(head), head->file_line);
+    darray_add(c->active, tmp);
+
+    info_print(expr_get_file_name(e->key), expr_get_file_line(e->key),
+               "moving loop invariant expression to '%s' (%d times, %d bytes).\n",
+               vars_get_long_name(c->v, tmp), e->count, bytes);
+    remark("invariants", expr_get_file_name(e->key), expr_get_file_line(e->key),
+           remark_applied, -bytes, gain, "moved loop invariant expression to '%s' (%d times)",
+           vars_get_long_name(c->v, tmp), e->count);
+
+    // Copy the expression before replacing the occurrences
+    expr *val = expr_new_void(m);
+    *val = *e->key;
+
+    licm_occur *o;
+    darray_foreach(o, c->occ)
+        if( o->entry == n )
+            set_var(o->node, tmp);
+
+    // Move the loop head to a new node, the old node is the assignment
+    expr *nxt = expr_new_stmt(m, 0, head->rgt, head->stmt);
+    nxt->lft = head->lft;
+    nxt->file_line = head->file_line;
+
+    expr *var = expr_new_var_num(m, tmp);
+    var->file_line = head->file_line;
+    head->stmt = STMT_LET_INV;
+    head->rgt = expr_new_bin(m, var, val, TOK_F_ASGN);
+    head->rgt->file_line = head->file_line;
+    head->lft = nxt;
+    c->num ++;
+    return nxt;
+}
+
+// Moves all invariant expressions out of one loop, returns the new
+// position of the loop head.
+static expr *do_loop(licm_ctx *c, expr *head, const expr *line)
+{
+    // Grow the written variables array if needed
+    if( c->nwritten < c->nvar )
+    {
+        free(c->written);
+        c->nwritten = c->nvar;
+        c->written = dcalloc(c->nwritten + 1, 1);
+    }
+
+    expr *close = loop_scan(c, head);
+    if( !close )
+        return head;
+
+    collect_loop(c, head, close);
+
+    c->loop_end = close;
+    licm_loop l;
+    l.close = close;
+    l.start = darray_len(c->active);
+
+    // Move the expressions with more gain first
+    for(;;)
+    {
+        int best = -1, best_gain = 0, best_bytes = 0;
+        for(unsigned i = 0; i < darray_len(c->lst); i++)
+        {
+            const licm_entry *e = &darray_i(c->lst, i);
+            int g, b;
+            if( e->done || entry_gain(c, e, line, &g, &b) )
+                continue;
+            if( g > best_gain )
+            {
+                best = i;
+                best_gain = g;
+                best_bytes = b;
+            }
+        }
+        if( best < 0 )
+            break;
+        darray_i(c->lst, best).done = 1;
+        head = move_entry(c, best, head, best_gain, best_bytes);
+    }
+
+    // Report the expressions not moved
+    if( remarks_enabled() )
+    {
+        licm_entry *e;
+        darray_foreach(e, c->lst)
+        {
+            int g, b;
+            if( e->done )
+                continue;
+            const char *why = entry_gain(c, e, line, &g, &b);
+            remark("invariants", expr_get_file_name(e->key), expr_get_file_line(e->key),
+                   remark_missed, -b, g, "loop invariant expression (%d times): %s",
+                   e->count, why ? why : "not profitable");
+        }
+    }
+
+    if( darray_len(c->active) > l.start )
+        darray_add(c->loops, l);
+    return head;
+}
+
+int opt_move_invariants(expr *prog, enum opt_objective obj)
+{
+    if( !prog )
+        return 0;
+
+    licm_ctx c;
+    c.v = pgm_get_vars( expr_get_program(prog) );
+    c.nvar = vars_get_total(c.v);
+    c.max_vars = (parser_get_dialect() == parser_dialect_turbo) ? 256 : 128;
+    c.obj = obj;
+    c.targets = opt_targets_new();
+    c.nwritten = c.nvar;
+    c.written = dcalloc(c.nwritten + 1, 1);
+    c.clobber = 0;
+    c.lst = darray_new(licm_entry, 64);
+    c.occ = darray_new(licm_occur, 64);
+    c.temps = darray_new(int, 16);
+    c.active = darray_new(int, 16);
+    c.loops = darray_new(licm_loop, 16);
+    c.num = 0;
+    opt_search_targets(c.targets, prog);
+
+    if( c.targets->all )
+    {
+        info_print(expr_get_file_name(prog), 0,
+                   "target line number not constant, can't move loop invariants.\n");
+        remark("invariants", expr_get_file_name(prog), 0, remark_missed, 0, 0,
+               "target line number not constant, can't move loop invariants");
+    }
+    else
+    {
+        const expr *line = 0;
+        for(expr *ex = prog; ex != 0; ex = ex->lft)
+        {
+            if( ex->type == et_lnum )
+                line = ex;
+            else if( ex->type == et_stmt )
+            {
+                // Outer loops are processed first, so the expressions are
+                // moved out of all the loops where those are invariant.
+                if( ex->stmt == STMT_FOR || ex->stmt == STMT_WHILE ||
+                    ex->stmt == STMT_REPEAT || ex->stmt == STMT_DO )
+                    ex = do_loop(&c, ex, line);
+                // At the loop end, the temporary variables can be reused
+                while( darray_len(c.loops) &&
+                       darray_i(c.loops, darray_len(c.loops) - 1).close == ex )
+                {
+                    darray_len(c.active) = darray_i(c.loops, darray_len(c.loops) - 1).start;
+                    darray_len(c.loops) --;
+                }
+            }
+        }
+    }
+
+    if( c.num )
+        info_print(expr_get_file_name(prog), 0,
+                   "moved %d loop invariant expressions, using %d temporary variables.\n",
+                   c.num, (int)darray_len(c.temps));
+
+    darray_free(c.loops);
+    darray_free(c.active);
+    darray_free(c.temps);
+    darray_free(c.occ);
+    darray_free(c.lst);
+    free(c.written);
+    opt_targets_free(c.targets);
+    return 0;
+}
@@ -20,6 +20,8 @@
 #include "expr.h"
 #include "dbg.h"
 #include "dmem.h"
+#include "optcost.h"
+#include "remarks.h"
 #include <assert.h>
 #include <stdlib.h>
 
@@ -33,13 +35,13 @@ static void bitmap_set(uint8_t *bmp, int n)
     bmp[n>>3] |= (1 << (n&7));
 }
 
-static int bitmap_get(uint8_t *bmp, int n)
+static int bitmap_get(const uint8_t *bmp, int n)
 {
     assert(n>=0 && n<32768);
     return 0 != (bmp[n>>3] & (1 << (n&7)));
 }
 
-static int expr_is_cnum(expr *ex)
+static int expr_is_cnum(const expr *ex)
 {
     return ex && (ex->type == et_c_number || ex->type == et_c_hexnumber);
 }
@@ -72,6 +74,19 @@ static int verify_target_line(expr *ex, uint8_t *keep, uint8_t *avail, int range
     }
 }
 
+// Verifies all the target line numbers of the statement
+static int verify_targets(expr *ex, uint8_t *keep, uint8_t *avail)
+{
+    int ret = 0;
+    expr *t = opt_stmt_targets(ex);
+    int range = ex->stmt == STMT_TRAP, ignore = ex->stmt == STMT_RESTORE;
+    for( ; t && t->type == et_tok && t->tok == TOK_COMMA; t = t->lft )
+        ret |= verify_target_line(t->rgt, keep, avail, range, ignore);
+    if( t )
+        ret |= verify_target_line(t, keep, avail, range, ignore);
+    return ret;
+}
+
 static int do_search_stmt(expr *ex, uint8_t *keep, uint8_t *avail)
 {
     assert(ex && ex->type == et_stmt);
@@ -190,50 +205,113 @@ static int do_search_stmt(expr *ex, uint8_t *keep, uint8_t *avail)
                  statements[ex->stmt].stm_long);
             return 0;
 
-        case STMT_RESTORE:
-            // Skip if no argument
-            if( !ex->rgt)
-                return 0;
+        case STMT_ON:
+            assert(ex->rgt && ex->rgt->type == et_tok);
+            if( (ex->rgt->tok == TOK_ON_GOTO || ex->rgt->tok == TOK_ON_GOSUB) &&
+                expr_is_cnum(ex->rgt->lft) )
+            {
+                // TODO
+                warn("'ON GOTO' with constant value %g, should optimize.\n", ex->rgt->lft->num);
+            }
             // Fall through
+        case STMT_RESTORE:
         case STMT_TRAP:
-            // Skip if argument is label
-            if( ex->rgt && ex->rgt->type == et_tok && ex->rgt->tok == TOK_SHARP )
+        case STMT_GOTO:
+        case STMT_GO_TO:
+        case STMT_GOSUB:
+            // Extract arguments, should be constant numbers
+            return verify_targets(ex, keep, avail);
+        case STMT_IF_NUMBER:
+            assert(ex->rgt && ex->rgt->type == et_tok && ex->rgt->tok == TOK_THEN);
+            return verify_targets(ex, keep, avail);
+    }
+    return 1;
+}
+
+expr *opt_stmt_targets(expr *ex)
+{
+    expr *t = ex->rgt;
+    switch( ex->stmt )
+    {
+        case STMT_RESTORE:
+        case STMT_TRAP:
+            // Skip if no argument or argument is label
+            if( !t || (t->type == et_tok && t->tok == TOK_SHARP) )
                 return 0;
-            // Fall through
+            return t;
         case STMT_GOTO:
         case STMT_GO_TO:
         case STMT_GOSUB:
-            // Extract argument, should be a constant number
-            return verify_target_line(ex->rgt, keep, avail, ex->stmt == STMT_TRAP,
-                                      ex->stmt == STMT_RESTORE );
+            return t;
         case STMT_ON:
-            assert(ex->rgt && ex->rgt->type == et_tok);
-            if( ex->rgt->tok == TOK_ON_GOTO || ex->rgt->tok == TOK_ON_GOSUB )
-            {
-                int ret = 0;
-                expr *l = ex->rgt->lft;
-                expr *r = ex->rgt->rgt;
-                if( expr_is_cnum(l) )
-                {
-                    // TODO
-                    warn("'ON GOTO' with constant value %g, should optimize.\n", l->num);
-                }
-                while( r && r->type == et_tok && r->tok == TOK_COMMA )
-                {
-                    ret |= verify_target_line(r->rgt, keep, avail, 0, 0);
-                    r = r->lft;
-                }
-                ret |= verify_target_line(r, keep, avail, 0, 0);
-                return ret;
-            }
+            if( t && t->type == et_tok && (t->tok == TOK_ON_GOTO || t->tok == TOK_ON_GOSUB) )
+                return t->rgt;
             return 0;
         case STMT_IF_NUMBER:
-            assert(ex->rgt && ex->rgt->type == et_tok && ex->rgt->tok == TOK_THEN);
-            return verify_target_line(ex->rgt->rgt, keep, avail, 0, 0);
+            // Without THEN, returns the argument that is not a line number
+            if( t && t->type == et_tok && t->tok == TOK_THEN )
+                return t->rgt;
+            return t;
+        default:
+            return 0;
+    }
+}
+
+lnum_targets *opt_targets_new(void)
+{
+    lnum_targets *t = dcalloc(1, sizeof(lnum_targets));
+    t->lines = dcalloc(32768/8, 1);
+    return t;
+}
+
+void opt_targets_free(lnum_targets *t)
+{
+    free(t->lines);
+    free(t);
+}
+
+int opt_add_target(lnum_targets *t, const expr *ex)
+{
+    if( !expr_is_cnum(ex) )
+    {
+        if( t->all )
+            return 0;
+        return t->all = 1;
     }
+    // Targets outside the valid range, as used to disable TRAP, are ignored
+    if( ex->num < 0 || ex->num >= 32767.5 )
+        return 0;
+    int n = (int)(ex->num + 0.5);
+    if( bitmap_get(t->lines, n) )
+        return 0;
+    bitmap_set(t->lines, n);
     return 1;
 }
 
+void opt_search_targets(lnum_targets *t, expr *prog)
+{
+    for(expr *ex = prog; ex; ex = ex->lft)
+    {
+        if( ex->type != et_stmt )
+            continue;
+        expr *l = opt_stmt_targets(ex);
+        for( ; l && l->type == et_tok && l->tok == TOK_COMMA; l = l->lft )
+            opt_add_target(t, l->rgt);
+        if( l )
+            opt_add_target(t, l);
+    }
+}
+
+int opt_is_target(const lnum_targets *t, const expr *ex)
+{
+    assert(ex->type == et_lnum);
+    if( ex->num < 0 )
+        return 0;
+    if( t->all || ex->num >= 32767.5 )
+        return 1;
+    return bitmap_get(t->lines, (int)(ex->num + 0.5));
+}
+
 
 int opt_remove_line_num(expr *prog)
 {
@@ -263,6 +341,8 @@ int opt_remove_line_num(expr *prog)
     // Bail out on any error
     if( err )
     {
+        remark("line_numbers", expr_get_file_name(prog), 0, remark_missed, 0, 0,
+               "target line number not constant, line numbers are not removed");
         free(avail);
         free(keep);
         return 0;
@@ -274,7 +354,10 @@ int opt_remove_line_num(expr *prog)
         {
             int inum = (int)(ex->num+0.5);
             assert(inum>=0 && inum<32768);
-            if( !bitmap_get(keep, inum) )
+            if( bitmap_get(keep, inum) )
+                remark("line_numbers", expr_get_file_name(ex), expr_get_file_line(ex),
+                       remark_missed, 0, 0, "line number %d is a jump target", inum);
+            else
             {
                 char buf[256];
                 int len = sprintf(buf, "old line %d", inum);
@@ -285,6 +368,8 @@ int opt_remove_line_num(expr *prog)
                 ex->rgt = rem;
                 info_print(expr_get_file_name(ex), expr_get_file_line(ex),
                            "removing line number %d.\n", inum);
+                remark("line_numbers", expr_get_file_name(ex), expr_get_file_line(ex),
+                       remark_applied, OPT_COST_LINE_BYTES, 0, "removed line number %d", inum);
 
             }
         }
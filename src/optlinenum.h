@@ -17,8 +17,37 @@
  */
 #pragma once
 
+#include <stdint.h>
+
 typedef struct expr_struct expr;
 
+// Line numbers that can be the target of a jump
+typedef struct {
+    uint8_t *lines;     // Bitmap with the target line numbers
+    int all;            // Any line number can be a target
+} lnum_targets;
+
 // Remove unused line numbers in a program
 int opt_remove_line_num(expr *ex);
 
+// Returns the line numbers referenced by the statement: the argument of
+// GOTO, GOSUB, TRAP, RESTORE and IF/THEN, or the list of ON GOTO/GOSUB
+// joined with TOK_COMMA. Returns NULL if the statement has no line numbers.
+expr *opt_stmt_targets(expr *ex);
+
+// Allocates an empty set of target line numbers
+lnum_targets *opt_targets_new(void);
+
+// Frees the set of target line numbers
+void opt_targets_free(lnum_targets *t);
+
+// Adds the line number in the expression to the set, a target that is not
+// constant sets "all". Returns 1 if the set changed.
+int opt_add_target(lnum_targets *t, const expr *ex);
+
+// Adds all the line numbers referenced by the statements in the program.
+void opt_search_targets(lnum_targets *t, expr *prog);
+
+// Returns true if the line number (an et_lnum node) can be a target
+int opt_is_target(const lnum_targets *t, const expr *ex);
+
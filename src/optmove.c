@@ -0,0 +1,297 @@
+/*
+ *  Basic Parser - TurboBasic XL compatible parsing and transformation tool.
+ *  Copyright (C) 2015 Daniel Serpell
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "optmove.h"
+#include "expr.h"
+#include "basexpr.h"
+#include "dbg.h"
+#include "optconst.h"
+#include "parser.h"
+#include "remarks.h"
+#include "optutil.h"
+#include <math.h>
+#include <string.h>
+
+// Replaces loops that copy or fill memory one byte at a time with MOVE,
+// that runs in machine code:
+//
+//   FOR I=S TO E:POKE A+I,PEEK(B+I):NEXT I
+//     -> MOVE B+S,A+S,E-S+1:I=E+1
+//   FOR I=E TO S STEP -1:POKE A+I,PEEK(B+I):NEXT I
+//     -> -MOVE B+S,A+S,E-S+1:I=S-1
+//   FOR I=S TO E:POKE A+I,V:NEXT I
+//     -> POKE A+S,V:MOVE A+S,A+S+1,E-S:I=E+1
+//
+// MOVE copies from the first byte to the last, and -MOVE from the last to
+// the first, so the copy is done in the same order as the loop and gives
+// the same result when the blocks overlap. The fill uses an overlapped MOVE
+// to copy the first byte to the following ones.
+//
+// The start and end of the loop must be integer constants, and the other
+// expressions can't depend on the memory or the loop variable.
+
+typedef struct {
+    enum opt_objective obj;
+    int count;          // Number of loops replaced
+} mv_ctx;
+
+static int check_hidden(const expr *ex)
+{
+    return ex && ex->type == et_stmt && ex->stmt == STMT_REM_HIDDEN;
+}
+
+// Returns true if the expression only uses constants, variables different
+// from "var" and arithmetic, so the value does not change in the loop.
+static int is_invariant(const expr *ex, unsigned var)
+{
+    if( !ex )
+        return 1;
+    switch( ex->type )
+    {
+        case et_c_number:
+        case et_c_hexnumber:
+            return 1;
+        case et_var_number:
+            return ex->var != var;
+        case et_tok:
+            switch( ex->tok )
+            {
+                case TOK_L_PRN:
+                case TOK_PLUS:
+                case TOK_MINUS:
+                case TOK_STAR:
+                case TOK_UMINUS:
+                case TOK_UPLUS:
+                    return is_invariant(ex->lft, var) && is_invariant(ex->rgt, var);
+                default:
+                    return 0;
+            }
+        default:
+            return 0;
+    }
+}
+
+static int is_var(const expr *ex, unsigned var)
+{
+    return ex && ex->type == et_var_number && ex->var == var;
+}
+
+// Matches "base+I", "I+base" or "I", returns 1 if found and sets the base
+// expression, NULL if there is no base.
+static int match_index(const expr *ex, unsigned var, const expr **base)
+{
+    while( ex && ex->type == et_tok && ex->tok == TOK_L_PRN )
+        ex = ex->rgt;
+    *base = 0;
+    if( is_var(ex, var) )
+        return 1;
+    if( !ex || ex->type != et_tok || ex->tok != TOK_PLUS )
+        return 0;
+    if( is_var(ex->rgt, var) )
+        *base = ex->lft;
+    else if( is_var(ex->lft, var) )
+        *base = ex->rgt;
+    else
+        return 0;
+    return is_invariant(*base, var);
+}
+
+// Returns the next statement, skipping comments and lines without number.
+static expr *next_stmt(expr *ex)
+{
+    for(ex = ex->lft; ex; ex = ex->lft)
+    {
+        if( ex->type == et_lnum && ex->num >= 0 )
+            return 0;
+        if( ex->type == et_stmt && !check_hidden(ex) )
+            return ex;
+    }
+    return 0;
+}
+
+static expr *new_num(expr *ex, double x)
+{
+    expr *n = expr_new_number(ex->mngr, x);
+    n->file_line = ex->file_line;
+    return n;
+}
+
+static expr *new_bin(expr *ex, expr *l, expr *r, enum enum_tokens tok)
+{
+    expr *n = expr_new_bin(ex->mngr, l, r, tok);
+    n->file_line = ex->file_line;
+    return n;
+}
+
+// Returns "base+x", "base" if x is 0, or "x" if there is no base. The base
+// is copied, as it is used more than once.
+static expr *new_addr(expr *ex, const expr *base, double x)
+{
+    if( !base )
+        return new_num(ex, x);
+    expr *b = expr_copy(ex->mngr, base);
+    if( x == 0 )
+        return b;
+    return new_bin(ex, b, new_num(ex, x), TOK_PLUS);
+}
+
+static expr *new_stmt(expr *ex, expr *args, enum enum_statements stmt)
+{
+    expr *n = expr_new_stmt(ex->mngr, 0, args, stmt);
+    n->file_line = ex->file_line;
+    if( args )
+        opt_constprop(args);
+    return n;
+}
+
+static int stmt_bytes(const expr *ex)
+{
+    // Statement length and statement tokens
+    return 1 + expr_get_bas_len(ex);
+}
+
+// Replace the statement "old" with the new statement "ex"
+static void replace_stmt(expr *old, const expr *ex)
+{
+    old->stmt = ex->stmt;
+    old->rgt = ex->rgt;
+}
+
+static void do_loop(mv_ctx *c, expr *loop)
+{
+    expr *var = opt_for_var(loop);
+    expr *poke = next_stmt(loop);
+    expr *next = poke ? next_stmt(poke) : 0;
+    if( !var || !poke || poke->stmt != STMT_POKE || !next || next->stmt != STMT_NEXT ||
+        !is_var(next->rgt, var->var) )
+        return;
+
+    const char *fname = expr_get_file_name(loop);
+    int fline = expr_get_file_line(loop);
+
+    const expr *p = poke->rgt, *dst, *src = 0, *val = 0;
+    if( !p || p->type != et_tok || p->tok != TOK_COMMA || !match_index(p->lft, var->var, &dst) )
+        return;
+    if( p->rgt && p->rgt->type == et_tok && p->rgt->tok == TOK_PEEK )
+    {
+        if( !match_index(p->rgt->rgt, var->var, &src) )
+            return;
+    }
+    else if( is_invariant(p->rgt, var->var) )
+        val = p->rgt;
+    else
+        return;
+
+    const char *desc = val ? "filling" : "copying";
+    double start, end, step;
+    if( !opt_for_bounds(loop, &start, &end, &step) )
+    {
+        remark("move_loops", fname, fline, remark_missed, 0, 0,
+               "loop %s memory not replaced: start, end or step not constant", desc);
+        return;
+    }
+    if( (step != 1 && step != -1) || start != floor(start) || end != floor(end) )
+        return;
+
+    // First and last bytes, and final value of the variable
+    double first = step > 0 ? start : end;
+    double last = step > 0 ? end : start;
+    double final = end + step;
+    double len = last - first + 1;
+    if( len < 2 || len > 65535 )
+        return;
+
+    expr *s1, *s2;
+    if( val )
+    {
+        expr *v = expr_new_void(loop->mngr);
+        *v = *val;
+        s1 = new_stmt(loop, new_bin(loop, new_addr(loop, dst, first), v, TOK_COMMA),
+                      STMT_POKE);
+        s2 = new_stmt(loop, new_bin(loop, new_bin(loop, new_addr(loop, dst, first),
+                                                  new_addr(loop, dst, first + 1), TOK_COMMA),
+                                    new_num(loop, len - 1), TOK_COMMA), STMT_MOVE);
+    }
+    else
+    {
+        s1 = 0;
+        s2 = new_stmt(loop, new_bin(loop, new_bin(loop, new_addr(loop, src, first),
+                                                  new_addr(loop, dst, first), TOK_COMMA),
+                                    new_num(loop, len), TOK_COMMA),
+                      step > 0 ? STMT_MOVE : STMT_N_MOVE);
+    }
+    expr *v = expr_new_var_num(loop->mngr, var->var);
+    v->file_line = loop->file_line;
+    expr *s3 = new_stmt(loop, new_bin(loop, v, new_num(loop, final), TOK_F_ASGN),
+                        STMT_LET_INV);
+
+    int bytes = (s1 ? stmt_bytes(s1) : 0) + stmt_bytes(s2) + stmt_bytes(s3) -
+                stmt_bytes(loop) - stmt_bytes(poke) - stmt_bytes(next);
+    int iter = opt_cost_stmt_time(STMT_POKE) + opt_cost_stmt_time(STMT_NEXT) +
+               2 * opt_cost_tok_time(TOK_PLUS) + (val ? 0 : opt_cost_tok_time(TOK_PEEK));
+    int time = (int)len * iter - opt_cost_stmt_time(STMT_MOVE) -
+               opt_cost_stmt_time(STMT_LET_INV) - (s1 ? opt_cost_stmt_time(STMT_POKE) : 0);
+    time = opt_cost_hot_time(loop, time);
+
+    if( !opt_cost_accept(c->obj, bytes, time) )
+    {
+        remark("move_loops", fname, fline, remark_missed, -bytes, time,
+               "loop %s memory not replaced: not profitable", desc);
+        return;
+    }
+
+    info_print(fname, fline, "replacing loop %s %.0f bytes with %s.\n", desc, len,
+               statements[s2->stmt].stm_long);
+    remark("move_loops", fname, fline, remark_applied, -bytes, time,
+           "replaced loop %s %.0f bytes with %s", desc, len, statements[s2->stmt].stm_long);
+
+    if( s1 )
+    {
+        replace_stmt(loop, s1);
+        replace_stmt(poke, s2);
+        replace_stmt(next, s3);
+    }
+    else
+    {
+        const char *txt = "loop replaced with MOVE";
+        replace_stmt(loop, s2);
+        replace_stmt(poke, s3);
+        next->stmt = STMT_REM_HIDDEN;
+        next->rgt = expr_new_data(next->mngr, (const uint8_t *)txt, strlen(txt), 0);
+    }
+    c->count ++;
+}
+
+int opt_move_loops(expr *prog, enum opt_objective obj)
+{
+    // Only TurboBasic XL has MOVE
+    if( !prog || parser_get_dialect() != parser_dialect_turbo )
+        return 0;
+
+    mv_ctx c;
+    c.obj = obj;
+    c.count = 0;
+
+    for(expr *ex = prog; ex; ex = ex->lft)
+        if( ex->type == et_stmt && ex->stmt == STMT_FOR )
+            do_loop(&c, ex);
+
+    if( c.count )
+        info_print(expr_get_file_name(prog), 0, "replaced %d loops with MOVE.\n", c.count);
+    return 0;
+}
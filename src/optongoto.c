@@ -0,0 +1,448 @@
+/*
+ *  Basic Parser - TurboBasic XL compatible parsing and transformation tool.
+ *  Copyright (C) 2015 Daniel Serpell
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "optongoto.h"
+#include "expr.h"
+#include "dbg.h"
+#include "dmem.h"
+#include "remarks.h"
+#include "optlinenum.h"
+#include <assert.h>
+#include <stdlib.h>
+
+// Converts chains of "IF V=1 THEN 100", "IF V=2 THEN 200", etc. to one
+// "ON V GOTO 100,200". Also converts "IF V=1 THEN GOSUB 100:GOTO 50" and
+// "IF V=1 THEN EXEC P1:GOTO 50" chains when the line 50 follows the chain.
+//
+// ON rounds the value and gives an error if it is negative or greater
+// than 255, so the variable must only be assigned integers from 0 to 255.
+
+// Maximum number of entries in the table
+#define ON_MAX_ENTRIES  255
+
+enum on_kind {
+    on_goto,
+    on_gosub,
+    on_exec
+};
+
+// One IF of the chain
+typedef struct {
+    expr *stmt;     // IF statement
+    expr *last;     // Last statement of the IF
+    unsigned var;   // Variable compared
+    int key;        // Value compared
+    enum on_kind kind;
+    expr *target;   // Target line number or PROC label
+    expr *exit;     // Line number of the GOTO after the GOSUB or EXEC
+    int bytes;      // Size of the IF
+} on_elem;
+
+typedef struct {
+    enum opt_objective obj;
+    lnum_targets *targets;  // Line numbers that are jump targets
+    expr *prog;
+    int count;          // Number of chains replaced
+} on_ctx;
+
+static int expr_is_cnum(const expr *ex)
+{
+    return ex && (ex->type == et_c_number || ex->type == et_c_hexnumber);
+}
+
+static int check_hidden(const expr *ex)
+{
+    return ex && ex->type == et_stmt && ex->stmt == STMT_REM_HIDDEN;
+}
+
+// Skips removed statements
+static expr *next_stmt(expr *ex)
+{
+    while( check_hidden(ex) )
+        ex = ex->lft;
+    return ex;
+}
+
+// Returns 1 if the program has statements that reference any line number
+static int uses_lines(expr *prog)
+{
+    for(expr *ex = prog; ex; ex = ex->lft)
+        if( ex->type == et_stmt &&
+            (ex->stmt == STMT_LIST || ex->stmt == STMT_DEL || ex->stmt == STMT_RENUM) )
+            return 1;
+    return 0;
+}
+
+// Returns true if the expression always gives an integer from 0 to 255,
+// assuming that the variable "var" also does.
+static int is_byte_expr(const expr *ex, unsigned var)
+{
+    if( !ex )
+        return 0;
+    if( expr_is_cnum(ex) )
+        return ex->num >= 0 && ex->num <= 255 && ex->num == (int)ex->num;
+    if( ex->type == et_var_number )
+        return ex->var == var;
+    if( ex->type != et_tok )
+        return 0;
+    switch( ex->tok )
+    {
+        case TOK_N_LEQ:
+        case TOK_N_NEQ:
+        case TOK_N_GEQ:
+        case TOK_N_LE:
+        case TOK_N_GE:
+        case TOK_N_EQ:
+        case TOK_S_LEQ:
+        case TOK_S_NEQ:
+        case TOK_S_GEQ:
+        case TOK_S_LE:
+        case TOK_S_GE:
+        case TOK_S_EQ:
+        case TOK_NOT:
+        case TOK_OR:
+        case TOK_AND:
+        case TOK_PEEK:
+        case TOK_ASC:
+        case TOK_PADDLE:
+        case TOK_STICK:
+        case TOK_PTRIG:
+        case TOK_STRIG:
+        case TOK_PER_0:
+        case TOK_PER_1:
+        case TOK_PER_2:
+        case TOK_PER_3:
+            return 1;
+        case TOK_L_PRN:
+        case TOK_UPLUS:
+            return is_byte_expr(ex->rgt, var);
+        case TOK_ANDPER:
+            return is_byte_expr(ex->lft, var) || is_byte_expr(ex->rgt, var);
+        default:
+            return 0;
+    }
+}
+
+// Returns true if the expression contains the variable
+static int uses_var(const expr *ex, unsigned var)
+{
+    if( !ex )
+        return 0;
+    if( ex->type == et_var_number && ex->var == var )
+        return 1;
+    return uses_var(ex->lft, var) || uses_var(ex->rgt, var);
+}
+
+// Returns true if all the assignments to the variable in the expression
+// are integers from 0 to 255.
+static int check_assign(const expr *ex, unsigned var)
+{
+    if( !ex || ex->type != et_tok )
+        return 1;
+    if( ex->tok == TOK_F_ASGN && ex->lft && ex->lft->type == et_var_number &&
+        ex->lft->var == var && !is_byte_expr(ex->rgt, var) )
+        return 0;
+    return check_assign(ex->lft, var) && check_assign(ex->rgt, var);
+}
+
+// Returns true if the variable always holds an integer from 0 to 255
+static int var_is_byte(const on_ctx *c, unsigned var)
+{
+    for(const expr *ex = c->prog; ex; ex = ex->lft)
+    {
+        if( ex->type != et_stmt )
+            continue;
+        switch( ex->stmt )
+        {
+            case STMT_LET:
+            case STMT_LET_INV:
+                if( !check_assign(ex->rgt, var) )
+                    return 0;
+                break;
+            case STMT_GET:
+            case STMT_LOCATE:
+                // Read bytes
+                break;
+            case STMT_ENTER:
+                return 0;
+            case STMT_FOR:
+            case STMT_NEXT:
+            case STMT_INPUT:
+            case STMT_P_GET:
+            case STMT_READ:
+            case STMT_NOTE:
+            case STMT_STATUS:
+            case STMT_PROC:
+            case STMT_PROC_VAR:
+            case STMT_LBL_S:
+                // Can write other values
+                if( uses_var(ex->rgt, var) )
+                    return 0;
+                break;
+            default:
+                break;
+        }
+    }
+    return 1;
+}
+
+// Parses "V=K" or "K=V", returns 0 if not valid.
+static int parse_cond(const expr *ex, on_elem *e)
+{
+    if( !ex || ex->type != et_tok || ex->tok != TOK_N_EQ )
+        return 0;
+    const expr *v = ex->lft, *k = ex->rgt;
+    if( expr_is_cnum(v) )
+    {
+        v = ex->rgt;
+        k = ex->lft;
+    }
+    if( !v || v->type != et_var_number || !expr_is_cnum(k) )
+        return 0;
+    if( k->num < 1 || k->num > ON_MAX_ENTRIES || k->num != (int)k->num )
+        return 0;
+    e->var = v->var;
+    e->key = k->num;
+    e->bytes = opt_cost_var_bytes(0) + 1 + opt_cost_num_bytes(k->num);
+    return 1;
+}
+
+// Parses one IF of the chain, returns 0 if not valid.
+static int parse_elem(expr *ex, on_elem *e)
+{
+    if( !ex || ex->type != et_stmt )
+        return 0;
+    e->stmt = ex;
+    e->exit = 0;
+    if( ex->stmt == STMT_IF_NUMBER )
+    {
+        if( !parse_cond(ex->rgt->lft, e) || !expr_is_cnum(ex->rgt->rgt) )
+            return 0;
+        e->kind = on_goto;
+        e->target = ex->rgt->rgt;
+        e->last = ex;
+        e->bytes += OPT_COST_STMT_BYTES + 1 + opt_cost_num_bytes(e->target->num);
+        return 1;
+    }
+    if( ex->stmt != STMT_IF_THEN || !ex->rgt || ex->rgt->rgt )
+        return 0;
+    if( !parse_cond(ex->rgt->lft, e) )
+        return 0;
+    e->bytes += 2 * OPT_COST_STMT_BYTES + 1;
+
+    expr *b = next_stmt(ex->lft);
+    if( !b || b->type != et_stmt )
+        return 0;
+    if( (b->stmt == STMT_GOTO || b->stmt == STMT_GO_TO || b->stmt == STMT_GOSUB) &&
+        expr_is_cnum(b->rgt) )
+    {
+        e->kind = b->stmt == STMT_GOSUB ? on_gosub : on_goto;
+        e->bytes += opt_cost_num_bytes(b->rgt->num);
+    }
+    else if( b->stmt == STMT_EXEC && b->rgt && b->rgt->type == et_var_label )
+    {
+        e->kind = on_exec;
+        e->bytes += opt_cost_var_bytes(0);
+    }
+    else
+        return 0;
+    e->target = b->rgt;
+
+    expr *n = next_stmt(b->lft);
+    // GOSUB and EXEC can be followed by a GOTO
+    if( e->kind != on_goto && n && n->type == et_stmt &&
+        (n->stmt == STMT_GOTO || n->stmt == STMT_GO_TO) && expr_is_cnum(n->rgt) )
+    {
+        e->exit = n->rgt;
+        e->bytes += OPT_COST_STMT_BYTES + opt_cost_num_bytes(n->rgt->num);
+        n = next_stmt(n->lft);
+    }
+    if( !n || n->type != et_stmt || n->stmt != STMT_ENDIF_INVISIBLE )
+        return 0;
+    e->last = n;
+    return 1;
+}
+
+// Skips line breaks and removed statements, and also line numbers that are
+// not jump targets if "skip_lnum" is set. Returns the next node.
+static expr *skip_lines(const on_ctx *c, expr *ex, int skip_lnum)
+{
+    while( ex )
+    {
+        if( ex->type == et_lnum && ex->num < 0 )
+            ex = ex->lft;
+        else if( ex->type == et_lnum && skip_lnum &&
+                 !opt_is_target(c->targets, ex) )
+            ex = ex->lft;
+        else if( check_hidden(ex) )
+            ex = ex->lft;
+        else
+            break;
+    }
+    return ex;
+}
+
+// Builds "ON V GOTO" from the chain, replacing the first IF.
+static void build_on(on_ctx *c, on_elem *el, int n, int size, double after)
+{
+    expr *ex = el[0].stmt;
+    expr_mngr *m = ex->mngr;
+    expr **table = dcalloc(size + 1, sizeof(expr *));
+    for(int i = 0; i < n; i++)
+        table[el[i].key] = el[i].target;
+
+    expr *lst = 0;
+    for(int i = 1; i <= size; i++)
+    {
+        expr *t = table[i];
+        if( !t )
+        {
+            t = expr_new_number(m, after);
+            t->file_line = ex->file_line;
+        }
+        lst = lst ? expr_new_bin(m, lst, t, TOK_COMMA) : t;
+    }
+    free(table);
+
+    enum enum_tokens tk = el[0].kind == on_goto ? TOK_ON_GOTO :
+                          el[0].kind == on_gosub ? TOK_ON_GOSUB : TOK_ON_EXEC;
+    expr *var = expr_new_var_num(m, el[0].var);
+    var->file_line = ex->file_line;
+    ex->stmt = STMT_ON;
+    ex->rgt = expr_new_bin(m, var, lst, tk);
+    ex->rgt->file_line = ex->file_line;
+    ex->lft = el[n - 1].last->lft;
+    c->count ++;
+}
+
+// Try to convert a chain starting at the statement, returns the last
+// statement processed.
+static expr *do_chain(on_ctx *c, expr *ex)
+{
+    on_elem el[ON_MAX_ENTRIES];
+    int n = 0;
+    uint8_t used[ON_MAX_ENTRIES + 1] = { 0 };
+
+    expr *p = ex;
+    while( n < ON_MAX_ENTRIES && parse_elem(p, &el[n]) )
+    {
+        if( n && (el[n].var != el[0].var || el[n].kind != el[0].kind || used[el[n].key]) )
+            break;
+        used[el[n].key] = 1;
+        p = skip_lines(c, el[n].last->lft, 1);
+        n++;
+    }
+    if( n < 2 )
+        return ex;
+
+    // Search the line after the chain
+    expr *nxt = skip_lines(c, el[n - 1].last->lft, 0);
+    double after = (nxt && nxt->type == et_lnum) ? nxt->num : -1;
+
+    int size = 0, bytes = 0;
+    for(int i = 0; i < n; i++)
+    {
+        if( el[i].key > size )
+            size = el[i].key;
+        bytes += el[i].bytes + (i ? OPT_COST_LINE_BYTES : 0);
+    }
+    const char *why = 0;
+    if( el[0].kind != on_goto )
+    {
+        // All the calls must continue at the line after the chain, and
+        // no value can be missing, as those should not call anything.
+        for(int i = 0; i < n && !why; i++)
+            if( (el[i].exit && el[i].exit->num != after) || (!el[i].exit && i != n - 1) )
+                why = "calls don't continue after the chain";
+        if( size != n )
+            why = "values are not consecutive";
+    }
+    else if( size != n && after < 0 )
+        why = "values are not consecutive";
+    if( !why && !var_is_byte(c, el[0].var) )
+        why = "variable can have values not valid in ON";
+
+    // New size: statement, variable, token, the table and the commas
+    int new_bytes = OPT_COST_STMT_BYTES + opt_cost_var_bytes(0) + 1 + size - 1;
+    for(int i = 1; i <= size; i++)
+    {
+        int found = 0;
+        for(int j = 0; j < n; j++)
+            if( el[j].key == i )
+            {
+                found = 1;
+                new_bytes += el[0].kind == on_exec ? opt_cost_var_bytes(0) :
+                             opt_cost_num_bytes(el[j].target->num);
+            }
+        if( !found )
+            new_bytes += opt_cost_num_bytes(after);
+    }
+    // Average number of comparisons skipped
+    int test = opt_cost_stmt_time(STMT_IF_THEN) + opt_cost_tok_time(TOK_N_EQ);
+    int time = opt_cost_hot_time(ex, (n + 1) * test / 2 - test);
+    bytes = new_bytes - bytes;
+    if( !why && !opt_cost_accept(c->obj, bytes, time) )
+        why = "not profitable";
+
+    if( why )
+    {
+        remark("on_goto", expr_get_file_name(ex), expr_get_file_line(ex), remark_missed,
+               -bytes, time, "chain of %d IF: %s", n, why);
+        return el[n - 1].last;
+    }
+
+    info_print(expr_get_file_name(ex), expr_get_file_line(ex),
+               "replacing chain of %d IF with ON.\n", n);
+    remark("on_goto", expr_get_file_name(ex), expr_get_file_line(ex), remark_applied,
+           -bytes, time, "replaced chain of %d IF with ON", n);
+    build_on(c, el, n, size, after);
+    return ex;
+}
+
+int opt_on_goto(expr *prog, enum opt_objective obj)
+{
+    if( !prog )
+        return 0;
+
+    on_ctx c;
+    c.obj = obj;
+    c.prog = prog;
+    c.count = 0;
+    c.targets = opt_targets_new();
+    opt_search_targets(c.targets, prog);
+
+    if( c.targets->all || uses_lines(prog) )
+    {
+        info_print(expr_get_file_name(prog), 0,
+                   "target line number not constant, can't convert IF chains to ON.\n");
+        remark("on_goto", expr_get_file_name(prog), 0, remark_missed, 0, 0,
+               "target line number not constant, IF chains are not converted");
+    }
+    else
+    {
+        for(expr *ex = prog; ex; ex = ex->lft)
+            if( ex->type == et_stmt )
+                ex = do_chain(&c, ex);
+        if( c.count )
+            info_print(expr_get_file_name(prog), 0,
+                       "replaced %d IF chains with ON.\n", c.count);
+    }
+
+    opt_targets_free(c.targets);
+    return 0;
+}
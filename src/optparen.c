@@ -0,0 +1,74 @@
+/*
+ *  Basic Parser - TurboBasic XL compatible parsing and transformation tool.
+ *  Copyright (C) 2015 Daniel Serpell
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "optparen.h"
+#include "expr.h"
+#include "basexpr.h"
+#include "dbg.h"
+#include "optcost.h"
+#include "remarks.h"
+#include <string.h>
+
+// Removes the parenthesis written in the source, as "(A*B)+C" or "((X))".
+//
+// The parenthesis are stored as TOK_L_PRN nodes, and written as is. The
+// writers already add the parenthesis needed by the structure of the tree,
+// using the precedence of the operators in tok_prec_level, so all the
+// TOK_L_PRN nodes can be removed and only the needed ones are written
+// back. The constant folding also removes those, this pass allows doing it
+// without the folding.
+
+// Collapses the parenthesis nodes, returns the number removed.
+static int remove_prn(expr *ex)
+{
+    if( !ex || ex->type == et_data )
+        return 0;
+    int n = 0;
+    while( ex->type == et_tok && ex->tok == TOK_L_PRN && !ex->lft && ex->rgt )
+    {
+        memcpy(ex, ex->rgt, sizeof(*ex));
+        n++;
+    }
+    return n + remove_prn(ex->lft) + remove_prn(ex->rgt);
+}
+
+int opt_remove_parens(expr *prog)
+{
+    int count = 0;
+    for(expr *ex = prog; ex; ex = ex->lft)
+    {
+        if( ex->type != et_stmt || !ex->rgt )
+            continue;
+        int old = expr_get_bas_len(ex);
+        if( !remove_prn(ex->rgt) )
+            continue;
+        // Some of the parenthesis could be written back
+        int bytes = old - expr_get_bas_len(ex);
+        if( bytes <= 0 )
+            continue;
+        int n = bytes / 2;
+        remark("parens", expr_get_file_name(ex), expr_get_file_line(ex), remark_applied,
+               bytes, opt_cost_hot_time(ex, n * opt_cost_tok_time(TOK_L_PRN)),
+               "removed %d parenthesis", n);
+        count += n;
+    }
+
+    if( count )
+        info_print(expr_get_file_name(prog), 0, "removed %d parenthesis.\n", count);
+    return 0;
+}
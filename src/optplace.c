@@ -0,0 +1,557 @@
+/*
+ *  Basic Parser - TurboBasic XL compatible parsing and transformation tool.
+ *  Copyright (C) 2015 Daniel Serpell
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "optplace.h"
+#include "optcost.h"
+#include "remarks.h"
+#include "expr.h"
+#include "dbg.h"
+#include "dmem.h"
+#include "darray.h"
+#include "optlinenum.h"
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+// The interpreter searches the program from the start each time it needs
+// to go to a line: on GOTO, GOSUB, RETURN, NEXT, etc. This pass moves the
+// blocks of lines that are jumped to more often to the start of the
+// program, preceded by a GOTO to the original first line, and renumbers
+// all the lines.
+
+// One line of the program, from a numbered line to the next one
+typedef struct {
+    expr *lnum;         // Line number node
+    expr *last;         // Last node of the line
+    int num;            // Line number
+    int new_num;        // Line number after the placement
+    unsigned nlines;    // Lines in the output, including forced breaks
+    unsigned long hot;  // Weight of the line searches for this line
+    int falls;          // Execution can continue to the next line
+    int empty;          // Line without statements, only comments
+    int target;         // Line is the target of a jump
+    int nest;           // Change of the nesting of structured statements
+    int min_nest;       // Minimum nesting inside the line
+    int fixed;          // Line can't be moved
+    int block;          // Index of the block starting at this line, or -1
+} pl_line;
+
+// A block of lines that can be moved
+typedef struct {
+    unsigned first;     // First line
+    unsigned end;       // Line after the last one
+    unsigned nlines;    // Number of lines in the output
+    unsigned long hot;  // Sum of the weights of the lines
+} pl_block;
+
+// A target line number in the program
+typedef struct {
+    expr *node;         // Constant with the line number
+    int restore;        // Can point to any line, RESTORE goes to the next
+} pl_target;
+
+typedef darray(pl_line) pl_line_list;
+typedef darray(pl_block) pl_block_list;
+typedef darray(pl_target) pl_target_list;
+typedef darray(unsigned) pl_index_list;
+
+typedef struct {
+    pl_line_list *lines;
+    pl_block_list *blocks;
+    pl_target_list *targets;
+    pl_index_list *loops;   // Lines with the open loops
+    int depth;              // Loop depth, for the static estimation
+} pl_ctx;
+
+static int expr_is_cnum(const expr *ex)
+{
+    return ex && (ex->type == et_c_number || ex->type == et_c_hexnumber);
+}
+
+// Weight of a search inside "depth" nested loops
+static unsigned long loop_weight(int depth)
+{
+    return 1UL << (3 * (depth < 4 ? depth : 4));
+}
+
+// Returns the index of the line with the given number, or -1
+static int find_line(const pl_ctx *c, double num, int restore)
+{
+    int a = 0, b = darray_len(c->lines);
+    while( a < b )
+    {
+        int m = (a + b) / 2;
+        if( darray_i(c->lines, m).num < num )
+            a = m + 1;
+        else
+            b = m;
+    }
+    if( a < (int)darray_len(c->lines) &&
+        (restore || darray_i(c->lines, a).num == num) )
+        return a;
+    return -1;
+}
+
+// Adds a target of the statement "ex" in line "cur" with the weight of the
+// search, returns 1 if the program can't be modified. If "est" is set, the
+// weight is an estimation and backward jumps are assumed to be loops.
+static int add_target(pl_ctx *c, const expr *ex, expr *t, unsigned cur, int restore,
+                      unsigned long w, int est)
+{
+    if( !expr_is_cnum(t) )
+    {
+        info_print(expr_get_file_name(ex), expr_get_file_line(ex),
+                   "target line number not constant, can't move lines.\n");
+        return 1;
+    }
+    // TRAP with a line number not valid disables the TRAP
+    if( t->num >= 32767.5 )
+        return 0;
+    int n = find_line(c, t->num, restore);
+    if( n < 0 )
+    {
+        info_print(expr_get_file_name(ex), expr_get_file_line(ex),
+                   "target line number %g not in the program, can't move lines.\n", t->num);
+        return 1;
+    }
+    pl_target tg = { t, restore };
+    darray_add(c->targets, tg);
+    // Backward jumps are loops, estimate more executions
+    if( est && (unsigned)n <= cur )
+        w *= 8;
+    darray_i(c->lines, n).hot += w;
+    darray_i(c->lines, n).target = 1;
+    return 0;
+}
+
+// Returns true if the expression reads the line number of the last error
+static int has_erl(const expr *ex)
+{
+    if( !ex || ex->type == et_data )
+        return 0;
+    if( ex->type == et_tok && ex->tok == TOK_ERL )
+        return 1;
+    return has_erl(ex->lft) || has_erl(ex->rgt);
+}
+
+// Searches the targets of the statement, updating the weights of the lines.
+// Returns 1 if the program can't be modified.
+static int scan_stmt(pl_ctx *c, expr *ex, unsigned cur)
+{
+    long cnt = opt_cost_exec_count(ex);
+    unsigned long w = cnt < 0 ? loop_weight(c->depth) : (unsigned long)cnt;
+    int est = cnt < 0;
+    pl_line *l = &darray_i(c->lines, cur);
+    expr *t = opt_stmt_targets(ex);
+
+    // ERL gives the original line numbers, that are changed
+    if( has_erl(ex->rgt) )
+    {
+        info_print(expr_get_file_name(ex), expr_get_file_line(ex),
+                   "ERL depends on line numbers, can't move lines.\n");
+        return 1;
+    }
+
+    if( t )
+    {
+        int restore = ex->stmt == STMT_RESTORE;
+        // RESTORE and TRAP don't search the line when executed
+        if( restore || ex->stmt == STMT_TRAP )
+            w = 0;
+        // RETURN searches the line of the GOSUB
+        if( ex->stmt == STMT_GOSUB || (ex->stmt == STMT_ON && ex->rgt->tok == TOK_ON_GOSUB) )
+            l->hot += w;
+        for( ; t->type == et_tok && t->tok == TOK_COMMA; t = t->lft )
+            if( add_target(c, ex, t->rgt, cur, restore, w, est) )
+                return 1;
+        return add_target(c, ex, t, cur, restore, w, est);
+    }
+
+    switch( ex->stmt )
+    {
+        case STMT_FOR:
+        case STMT_WHILE:
+        case STMT_REPEAT:
+        case STMT_DO:
+            darray_add(c->loops, cur);
+            c->depth ++;
+            return 0;
+        case STMT_NEXT:
+        case STMT_WEND:
+        case STMT_UNTIL:
+        case STMT_LOOP:
+            // Jumps back to the loop start, searching the line
+            if( darray_len(c->loops) )
+            {
+                darray_len(c->loops) --;
+                unsigned start = darray_i(c->loops, darray_len(c->loops));
+                darray_i(c->lines, start).hot += w;
+            }
+            if( c->depth )
+                c->depth --;
+            return 0;
+        case STMT_STOP:
+        case STMT_CONT:
+        case STMT_DEL:
+        case STMT_RENUM:
+        case STMT_LIST:
+            info_print(expr_get_file_name(ex), expr_get_file_line(ex),
+                       "%s depends on line numbers, can't move lines.\n",
+                       statements[ex->stmt].stm_long);
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+// Returns the change in the nesting of structured statements
+static int stmt_nest(const expr *ex)
+{
+    switch( ex->stmt )
+    {
+        case STMT_FOR:
+        case STMT_WHILE:
+        case STMT_REPEAT:
+        case STMT_DO:
+        case STMT_IF_MULTILINE:
+        case STMT_IF_THEN:
+            return 1;
+        case STMT_NEXT:
+        case STMT_WEND:
+        case STMT_UNTIL:
+        case STMT_LOOP:
+        case STMT_ENDIF:
+        case STMT_ENDIF_INVISIBLE:
+            return -1;
+        default:
+            return 0;
+    }
+}
+
+// Statements that never continue to the next statement
+static int stmt_jumps(const expr *ex)
+{
+    return ex->stmt == STMT_GOTO || ex->stmt == STMT_GO_TO || ex->stmt == STMT_RETURN ||
+           ex->stmt == STMT_END || ex->stmt == STMT_RUN;
+}
+
+static int stmt_is_rem(const expr *ex)
+{
+    return ex->stmt == STMT_REM || ex->stmt == STMT_REM_ || ex->stmt == STMT_REM_HIDDEN;
+}
+
+// Splits the program in lines, returns 1 if the program can't be modified.
+static int split_lines(pl_ctx *c, expr *prog)
+{
+    if( !prog || prog->type != et_lnum || prog->num < 0 )
+        return 1;
+
+    pl_line *l = 0;
+    int brk = 0;
+    for(expr *ex = prog; ex; ex = ex->lft)
+    {
+        if( ex->type == et_lnum && ex->num >= 0 )
+        {
+            if( l && ex->num <= l->num )
+                return 1;
+            pl_line nl;
+            memset(&nl, 0, sizeof(nl));
+            nl.lnum = ex;
+            nl.num = ex->num;
+            nl.nlines = 1;
+            nl.falls = 1;
+            nl.empty = 1;
+            nl.block = -1;
+            darray_add(c->lines, nl);
+            l = &darray_i(c->lines, darray_len(c->lines) - 1);
+            brk = 0;
+        }
+        else if( ex->type == et_lnum )
+            brk = 1;
+        else if( ex->type == et_stmt )
+        {
+            // A forced break only uses a line number if followed by statements
+            if( brk )
+                l->nlines ++;
+            brk = 0;
+            l->nest += stmt_nest(ex);
+            if( l->nest < l->min_nest )
+                l->min_nest = l->nest;
+            // ELSE must stay with the IF
+            if( ex->stmt == STMT_ELSE && l->min_nest > l->nest - 1 )
+                l->min_nest = l->nest - 1;
+            if( ex->stmt == STMT_DATA || ex->stmt == STMT_PROC ||
+                ex->stmt == STMT_PROC_VAR || ex->stmt == STMT_ENDPROC )
+                l->fixed = 1;
+            if( !stmt_is_rem(ex) )
+            {
+                l->falls = !stmt_jumps(ex);
+                l->empty = 0;
+            }
+        }
+        l->last = ex;
+    }
+    return 0;
+}
+
+// Search blocks that start at a target line, are not reached from the
+// previous line and don't continue to the next line.
+static void search_blocks(pl_ctx *c)
+{
+    unsigned n = darray_len(c->lines);
+    // Lines with only comments are reached only if the previous line
+    // continues to them or they are a jump target
+    int reached = 1;
+    for(unsigned i = 1; i < n; i++)
+    {
+        const pl_line *prev = &darray_i(c->lines, i - 1);
+        const pl_line *start = &darray_i(c->lines, i);
+        if( prev->empty )
+            reached = reached || prev->target;
+        else
+            reached = prev->falls;
+        if( !start->hot || reached )
+            continue;
+        pl_block b = { i, 0, 0, 0 };
+        int nest = 0;
+        for(unsigned j = i; j < n; j++)
+        {
+            const pl_line *l = &darray_i(c->lines, j);
+            if( l->fixed || nest + l->min_nest < 0 )
+                break;
+            nest += l->nest;
+            b.nlines += l->nlines;
+            b.hot += l->hot;
+            if( !nest && !l->falls )
+            {
+                b.end = j + 1;
+                break;
+            }
+        }
+        if( !b.end )
+            continue;
+        darray_i(c->lines, i).block = darray_len(c->blocks);
+        darray_add(c->blocks, b);
+        i = b.end - 1;
+    }
+}
+
+// Cost of all the line searches with the given blocks moved to the start
+static unsigned long long layout_cost(const pl_ctx *c, const pl_index_list *front)
+{
+    unsigned long long cost = 0;
+    unsigned long pos = front->len ? 1 : 0;
+    for(unsigned i = 0; i < front->len; i++)
+    {
+        const pl_block *b = &darray_i(c->blocks, front->data[i]);
+        for(unsigned j = b->first; j < b->end; j++)
+        {
+            const pl_line *l = &darray_i(c->lines, j);
+            cost += (unsigned long long)l->hot * pos;
+            pos += l->nlines;
+        }
+    }
+    for(unsigned j = 0; j < darray_len(c->lines); j++)
+    {
+        const pl_line *l = &darray_i(c->lines, j);
+        if( l->block == -2 )
+            continue;
+        cost += (unsigned long long)l->hot * pos;
+        pos += l->nlines;
+    }
+    return cost;
+}
+
+static void mark_block(pl_ctx *c, unsigned n, int mark)
+{
+    const pl_block *b = &darray_i(c->blocks, n);
+    for(unsigned j = b->first; j < b->end; j++)
+        darray_i(c->lines, j).block = mark;
+}
+
+static const pl_block *sort_blocks_base;
+static int block_comp(const void *pa, const void *pb)
+{
+    const pl_block *a = sort_blocks_base + *(const unsigned *)pa;
+    const pl_block *b = sort_blocks_base + *(const unsigned *)pb;
+    // Most searches per line first
+    unsigned long long ka = (unsigned long long)a->hot * b->nlines;
+    unsigned long long kb = (unsigned long long)b->hot * a->nlines;
+    if( ka != kb )
+        return ka > kb ? -1 : 1;
+    return a->first < b->first ? -1 : a->first > b->first;
+}
+
+// Selects the blocks to move, in order
+static void select_blocks(pl_ctx *c, pl_index_list *front)
+{
+    unsigned nb = darray_len(c->blocks);
+    unsigned *order = dmalloc(sizeof(unsigned) * (nb + 1));
+    for(unsigned i = 0; i < nb; i++)
+        order[i] = i;
+    sort_blocks_base = c->blocks->data;
+    qsort(order, nb, sizeof(unsigned), block_comp);
+
+    unsigned long long best = layout_cost(c, front);
+    for(unsigned i = 0; i < nb; i++)
+    {
+        unsigned n = order[i];
+        darray_add(front, n);
+        mark_block(c, n, -2);
+        unsigned long long cost = layout_cost(c, front);
+        if( cost < best )
+            best = cost;
+        else
+        {
+            front->len --;
+            mark_block(c, n, -1);
+        }
+    }
+    free(order);
+}
+
+static void link_line(expr **last, const pl_line *l)
+{
+    (*last)->lft = l->lnum;
+    *last = l->last;
+}
+
+// Moves the blocks and renumbers all the lines
+static void move_blocks(pl_ctx *c, expr *prog, const pl_index_list *front)
+{
+    expr_mngr *m = prog->mngr;
+    unsigned n = darray_len(c->lines);
+
+    // New numbers, starting after the GOTO line
+    int num = 1;
+    for(unsigned i = 0; i < front->len; i++)
+    {
+        const pl_block *b = &darray_i(c->blocks, front->data[i]);
+        for(unsigned j = b->first; j < b->end; j++)
+        {
+            pl_line *l = &darray_i(c->lines, j);
+            l->new_num = num;
+            num += l->nlines;
+        }
+    }
+    for(unsigned j = 0; j < n; j++)
+    {
+        pl_line *l = &darray_i(c->lines, j);
+        if( l->block != -2 )
+        {
+            l->new_num = num;
+            num += l->nlines;
+        }
+    }
+
+    // Update all the targets
+    pl_target *t;
+    darray_foreach(t, c->targets)
+    {
+        int i = find_line(c, t->node->num, t->restore);
+        assert(i >= 0);
+        t->node->num = darray_i(c->lines, i).new_num;
+    }
+    for(unsigned j = 0; j < n; j++)
+    {
+        pl_line *l = &darray_i(c->lines, j);
+        l->lnum->num = l->new_num;
+    }
+
+    // Link the lines in the new order, starting with "GOTO first line"
+    expr *head = expr_new_lnum(m, 0, 0);
+    head->file_line = prog->file_line;
+    expr *last = expr_new_stmt(m, head, expr_new_number(m, darray_i(c->lines, 0).new_num),
+                               STMT_GOTO);
+    last->file_line = prog->file_line;
+    for(unsigned i = 0; i < front->len; i++)
+    {
+        const pl_block *b = &darray_i(c->blocks, front->data[i]);
+        for(unsigned j = b->first; j < b->end; j++)
+            link_line(&last, &darray_i(c->lines, j));
+    }
+    expr *pred = last;
+    for(unsigned j = 0; j < n; j++)
+        if( darray_i(c->lines, j).block != -2 )
+            link_line(&last, &darray_i(c->lines, j));
+    last->lft = 0;
+
+    // The first node of the program must not change, swap it with the new head
+    expr tmp = *head;
+    *head = *prog;
+    *prog = tmp;
+    pred->lft = head;
+    if( darray_i(c->lines, 0).last == prog )
+        darray_i(c->lines, 0).last = head;
+}
+
+int opt_place_hot(expr *prog)
+{
+    if( !prog )
+        return 0;
+
+    pl_ctx c;
+    c.lines = darray_new(pl_line, 256);
+    c.blocks = darray_new(pl_block, 16);
+    c.targets = darray_new(pl_target, 64);
+    c.loops = darray_new(unsigned, 16);
+    c.depth = 0;
+
+    int err = split_lines(&c, prog);
+    if( !err )
+    {
+        unsigned cur = 0;
+        for(expr *ex = prog; ex && !err; ex = ex->lft)
+        {
+            if( ex->type == et_lnum && ex->num >= 0 )
+                cur = find_line(&c, ex->num, 0);
+            else if( ex->type == et_stmt )
+                err = scan_stmt(&c, ex, cur);
+        }
+    }
+
+    if( !err )
+    {
+        pl_index_list *front = darray_new(unsigned, 16);
+        search_blocks(&c);
+        select_blocks(&c, front);
+        for(unsigned i = 0; i < front->len; i++)
+        {
+            const pl_block *b = &darray_i(c.blocks, front->data[i]);
+            const pl_line *l = &darray_i(c.lines, b->first);
+            info_print(expr_get_file_name(l->lnum), expr_get_file_line(l->lnum),
+                       "moving lines %d to %d to the program start.\n",
+                       l->num, darray_i(c.lines, b->end - 1).num);
+            remark("placement", expr_get_file_name(l->lnum), expr_get_file_line(l->lnum),
+                   remark_applied, 0, 0, "moved lines %d to %d to the program start",
+                   l->num, darray_i(c.lines, b->end - 1).num);
+        }
+        if( front->len )
+            move_blocks(&c, prog, front);
+        darray_free(front);
+    }
+    else
+        remark("placement", expr_get_file_name(prog), 0, remark_missed, 0, 0,
+               "line numbers can't be changed");
+
+    darray_free(c.loops);
+    darray_free(c.targets);
+    darray_free(c.blocks);
+    darray_free(c.lines);
+    return 0;
+}
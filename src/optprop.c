@@ -0,0 +1,818 @@
+/*
+ *  Basic Parser - TurboBasic XL compatible parsing and transformation tool.
+ *  Copyright (C) 2015 Daniel Serpell
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "optprop.h"
+#include "optconst.h"
+#include "expr.h"
+#include "vars.h"
+#include "dbg.h"
+#include "dmem.h"
+#include "darray.h"
+#include "optcost.h"
+#include "optlinenum.h"
+#include "program.h"
+#include "optutil.h"
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+// Known value of a variable at one point of the program
+enum vknown {
+    vk_unknown = 0,
+    vk_const,       // Variable holds a constant number
+    vk_copy         // Variable holds the same value as other variable
+};
+
+typedef struct {
+    enum vknown known;
+    enum enum_etype type; // Type of constant, number or hex-number
+    double num;           // Value if constant
+    unsigned src;         // Source variable if copy
+} vstate;
+
+// State saved at the start of a structured block (IF or loop)
+typedef struct {
+    enum enum_statements stmt; // Statement opening the block
+    unsigned var;              // Variable of FOR loops
+    int has_else;              // IF block with ELSE
+    vstate *st;                // State at the start of the block
+    vstate *alt;               // State at the end of the THEN part
+} block;
+
+typedef darray(block) block_list;
+
+typedef struct {
+    vstate *st;         // Current state
+    unsigned nv;        // Number of variables
+    lnum_targets *targets;
+    enum opt_objective obj;
+    vars *v;
+    block_list *blocks;
+} prop_ctx;
+
+// How a statement affects the variables and the program flow
+enum flow_class {
+    fc_none,    // Does not use variables
+    fc_read,    // Only reads variables
+    fc_branch,  // Reads variables, can continue elsewhere
+    fc_assign,  // Assignment of one variable
+    fc_write,   // Writes to all variables in the statement
+    fc_jump,    // Continues elsewhere, never at next statement
+    fc_end,     // Ends the program
+    fc_call,    // Calls a subroutine or alters any variable
+    fc_target,  // Labels and procedures, target of jumps
+    fc_block    // Structured statements
+};
+
+static enum flow_class stmt_class(enum enum_statements stmt)
+{
+    switch(stmt)
+    {
+        case STMT_DATA:
+        case STMT_REM:
+        case STMT_REM_:
+        case STMT_REM_HIDDEN:
+            return fc_none;
+
+        case STMT_BGET:
+        case STMT_BLOAD:
+        case STMT_BPUT:
+        case STMT_CIRCLE:
+        case STMT_CLOSE:
+        case STMT_CLS:
+        case STMT_COLOR:
+        case STMT_COM:
+        case STMT_CSAVE:
+        case STMT_DEG:
+        case STMT_DELETE:
+        case STMT_DIM:
+        case STMT_DIR:
+        case STMT_DPOKE:
+        case STMT_DRAWTO:
+        case STMT_DSOUND:
+        case STMT_DUMP:
+        case STMT_F_B:
+        case STMT_FCOLOR:
+        case STMT_F_F:
+        case STMT_FILLTO:
+        case STMT_F_L:
+        case STMT_GRAPHICS:
+        case STMT_LIST:
+        case STMT_LOCK:
+        case STMT_LPRINT:
+        case STMT_MOVE:
+        case STMT_N_MOVE:
+        case STMT_OPEN:
+        case STMT_PAINT:
+        case STMT_PAUSE:
+        case STMT_PLOT:
+        case STMT_POINT:
+        case STMT_POKE:
+        case STMT_POSITION:
+        case STMT_PRINT:
+        case STMT_PRINT_:
+        case STMT_PUT:
+        case STMT_P_PUT:
+        case STMT_RAD:
+        case STMT_RENAME:
+        case STMT_RESTORE:
+        case STMT_SAVE:
+        case STMT_SETCOLOR:
+        case STMT_SOUND:
+        case STMT_TEXT:
+        case STMT_TIME_S:
+        case STMT_TRACE:
+        case STMT_UNLOCK:
+        case STMT_XIO:
+            return fc_read;
+
+        case STMT_IF_NUMBER:
+        case STMT_POP:
+        case STMT_TRAP:
+            return fc_branch;
+
+        case STMT_LET:
+        case STMT_LET_INV:
+            return fc_assign;
+
+        case STMT_GET:
+        case STMT_INPUT:
+        case STMT_LOCATE:
+        case STMT_NOTE:
+        case STMT_P_GET:
+        case STMT_READ:
+        case STMT_STATUS:
+            return fc_write;
+
+        case STMT_ENDPROC:
+        case STMT_GO_S:
+        case STMT_GOTO:
+        case STMT_GO_TO:
+        case STMT_RETURN:
+            return fc_jump;
+
+        case STMT_BYE:
+        case STMT_CLOAD:
+        case STMT_CONT:
+        case STMT_DOS:
+        case STMT_END:
+        case STMT_LOAD:
+        case STMT_NEW:
+        case STMT_RUN:
+        case STMT_STOP:
+            return fc_end;
+
+        case STMT_BAS_ERROR:
+        case STMT_BRUN:
+        case STMT_CLR:
+        case STMT_DEL:
+        case STMT_ENTER:
+        case STMT_EXEC:
+        case STMT_EXEC_PAR:
+        case STMT_GOSUB:
+        case STMT_IF:
+        case STMT_ON:
+        case STMT_RENUM:
+            return fc_call;
+
+        case STMT_LBL_S:
+        case STMT_PROC:
+        case STMT_PROC_VAR:
+            return fc_target;
+
+        case STMT_DO:
+        case STMT_ELSE:
+        case STMT_ENDIF:
+        case STMT_ENDIF_INVISIBLE:
+        case STMT_EXIT:
+        case STMT_FOR:
+        case STMT_IF_MULTILINE:
+        case STMT_IF_THEN:
+        case STMT_LOOP:
+        case STMT_NEXT:
+        case STMT_REPEAT:
+        case STMT_UNTIL:
+        case STMT_WEND:
+        case STMT_WHILE:
+            return fc_block;
+    }
+    return fc_call;
+}
+
+static int expr_is_cnum(const expr *ex)
+{
+    return ex && (ex->type == et_c_number || ex->type == et_c_hexnumber);
+}
+
+static void kill_all(prop_ctx *c)
+{
+    memset(c->st, 0, sizeof(vstate) * c->nv);
+}
+
+// Variable is written, forget the value and all copies of it
+static void kill_var(prop_ctx *c, unsigned id)
+{
+    assert(id < c->nv);
+    c->st[id].known = vk_unknown;
+    for(unsigned i=0; i<c->nv; i++)
+        if( c->st[i].known == vk_copy && c->st[i].src == id )
+            c->st[i].known = vk_unknown;
+}
+
+// Forget the value of all variables in the expression
+static void kill_vars(prop_ctx *c, const expr *ex)
+{
+    if( !ex )
+        return;
+    if( ex->type == et_var_number )
+        kill_var(c, ex->var);
+    kill_vars(c, ex->lft);
+    kill_vars(c, ex->rgt);
+}
+
+// Joins two program paths, keeping only the values that agree
+static void merge_state(prop_ctx *c, const vstate *o)
+{
+    for(unsigned i=0; i<c->nv; i++)
+    {
+        vstate *s = &c->st[i];
+        if( s->known != o[i].known )
+            s->known = vk_unknown;
+        else if( s->known == vk_const && (s->num != o[i].num || s->type != o[i].type) )
+            s->known = vk_unknown;
+        else if( s->known == vk_copy && s->src != o[i].src )
+            s->known = vk_unknown;
+    }
+}
+
+static vstate *copy_state(prop_ctx *c)
+{
+    vstate *s = dmalloc(sizeof(vstate) * (c->nv + 1));
+    memcpy(s, c->st, sizeof(vstate) * c->nv);
+    return s;
+}
+
+static void push_block(prop_ctx *c, enum enum_statements stmt, unsigned var)
+{
+    block b;
+    b.stmt = stmt;
+    b.var = var;
+    b.has_else = 0;
+    b.st = copy_state(c);
+    b.alt = 0;
+    darray_add(c->blocks, b);
+}
+
+static void pop_block(prop_ctx *c)
+{
+    assert(darray_len(c->blocks));
+    block *b = &darray_i(c->blocks, darray_len(c->blocks) - 1);
+    free(b->st);
+    free(b->alt);
+    darray_len(c->blocks) --;
+}
+
+static block *top_block(prop_ctx *c)
+{
+    if( !darray_len(c->blocks) )
+        return 0;
+    return &darray_i(c->blocks, darray_len(c->blocks) - 1);
+}
+
+// Unbalanced blocks, forget everything
+static void reset_blocks(prop_ctx *c)
+{
+    while( darray_len(c->blocks) )
+        pop_block(c);
+    kill_all(c);
+}
+
+// Evaluates a numeric expression using the known values, returns 1 if the
+// expression has a constant value. Only the operations that "do_constprop"
+// folds without warnings are evaluated.
+static int eval_num(const prop_ctx *c, const expr *ex, double *val)
+{
+    double l = 0, r = 0;
+
+    if( !ex )
+        return 0;
+    if( expr_is_cnum(ex) )
+    {
+        *val = ex->num;
+        return 1;
+    }
+    if( ex->type == et_var_number )
+    {
+        if( c->st[ex->var].known != vk_const )
+            return 0;
+        *val = c->st[ex->var].num;
+        return 1;
+    }
+    if( ex->type != et_tok )
+        return 0;
+
+    // Evaluate operands
+    if( ex->lft && !eval_num(c, ex->lft, &l) )
+        return 0;
+    if( ex->rgt && !eval_num(c, ex->rgt, &r) )
+        return 0;
+
+    int bin = ex->lft && ex->rgt;
+    int uni = !ex->lft && ex->rgt;
+    switch( ex->tok )
+    {
+        case TOK_OR:     if( !bin ) return 0; *val = (l != 0) || (r != 0); break;
+        case TOK_AND:    if( !bin ) return 0; *val = (l != 0) && (r != 0); break;
+        case TOK_N_LEQ:  if( !bin ) return 0; *val = l <= r; break;
+        case TOK_N_NEQ:  if( !bin ) return 0; *val = l != r; break;
+        case TOK_N_GEQ:  if( !bin ) return 0; *val = l >= r; break;
+        case TOK_N_LE:   if( !bin ) return 0; *val = l < r; break;
+        case TOK_N_GE:   if( !bin ) return 0; *val = l > r; break;
+        case TOK_N_EQ:   if( !bin ) return 0; *val = l == r; break;
+        case TOK_PLUS:   if( !bin ) return 0; *val = l + r; break;
+        case TOK_MINUS:  if( !bin ) return 0; *val = l - r; break;
+        case TOK_STAR:   if( !bin ) return 0; *val = l * r; break;
+        case TOK_CARET:  if( !bin ) return 0; *val = pow(l, r); break;
+        case TOK_SLASH:
+            if( !bin || r == 0 ) return 0;
+            *val = l / r;
+            break;
+        case TOK_DIV:
+            if( !bin || r == 0 ) return 0;
+            *val = trunc(l / r);
+            break;
+        case TOK_MOD:
+            if( !bin || r == 0 ) return 0;
+            *val = l - r * trunc(l / r);
+            break;
+        case TOK_ANDPER:
+        case TOK_EXCLAM:
+        case TOK_EXOR:
+            if( !bin || l < 0 || r < 0 || l >= 65534.5 || r >= 65534.5 )
+                return 0;
+            if( ex->tok == TOK_ANDPER )
+                *val = lrint(l) & lrint(r);
+            else if( ex->tok == TOK_EXCLAM )
+                *val = lrint(l) | lrint(r);
+            else
+                *val = lrint(l) ^ lrint(r);
+            break;
+        case TOK_NOT:    if( !uni ) return 0; *val = 0 == r; break;
+        case TOK_UMINUS: if( !uni ) return 0; *val = -r; break;
+        case TOK_UPLUS:
+        case TOK_L_PRN:  if( !uni ) return 0; *val = r; break;
+        case TOK_TRUNC:  if( !uni ) return 0; *val = trunc(r); break;
+        case TOK_FRAC:   if( !uni ) return 0; *val = r - trunc(r); break;
+        case TOK_SGN:    if( !uni ) return 0; *val = r < 0 ? -1 : r > 0 ? 1 : 0; break;
+        case TOK_ABS:    if( !uni ) return 0; *val = fabs(r); break;
+        case TOK_INT:    if( !uni ) return 0; *val = floor(r); break;
+        case TOK_PER_0:  *val = 0; break;
+        case TOK_PER_1:  *val = 1; break;
+        case TOK_PER_2:  *val = 2; break;
+        case TOK_PER_3:  *val = 3; break;
+        default:
+            return 0;
+    }
+    return isfinite(*val);
+}
+
+// Returns true if the expression contains a variable with known value
+static int has_const_var(const prop_ctx *c, const expr *ex)
+{
+    if( !ex )
+        return 0;
+    if( ex->type == et_var_number && c->st[ex->var].known == vk_const )
+        return 1;
+    return has_const_var(c, ex->lft) || has_const_var(c, ex->rgt);
+}
+
+// Replaces one variable with the known constant value
+static int replace_var(prop_ctx *c, expr *ex)
+{
+    const vstate *vs = &c->st[ex->var];
+    info_print(expr_get_file_name(ex), expr_get_file_line(ex),
+               "replacing variable '%s' with value %.12g.\n",
+               vars_get_long_name(c->v, ex->var), vs->num);
+    ex->type = vs->type;
+    ex->num = vs->num;
+    return 1;
+}
+
+// Replaces all variables with known values in the expression
+static int replace_all_vars(prop_ctx *c, expr *ex)
+{
+    if( !ex )
+        return 0;
+    if( ex->type == et_var_number && c->st[ex->var].known == vk_const )
+        return replace_var(c, ex);
+    return replace_all_vars(c, ex->lft) + replace_all_vars(c, ex->rgt);
+}
+
+// Returns true if a replacement that adds "bytes" and saves "time" should be
+// done. Replacements that are not bigger are always done, as those allow
+// removing the assignment later.
+static int accept(const prop_ctx *c, const expr *ex, int bytes, int time)
+{
+    return bytes <= 0 || opt_cost_accept(c->obj, bytes, opt_cost_hot_time(ex, time));
+}
+
+// Replaces known values on an expression where variables are being read. A
+// constant is used if the objective accepts the size of the result.
+static int do_propagate(prop_ctx *c, expr *ex)
+{
+    if( !ex )
+        return 0;
+
+    if( ex->type == et_var_number )
+    {
+        const vstate *vs = &c->st[ex->var];
+        if( vs->known == vk_const &&
+            accept(c, ex, opt_cost_num_bytes(vs->num) - opt_cost_var_bytes(ex->var), 0) )
+            return replace_var(c, ex);
+        if( vs->known == vk_copy &&
+            accept(c, ex, opt_cost_var_bytes(vs->src) - opt_cost_var_bytes(ex->var), 0) )
+        {
+            info_print(expr_get_file_name(ex), expr_get_file_line(ex),
+                       "replacing variable '%s' with copy '%s'.\n",
+                       vars_get_long_name(c->v, ex->var),
+                       vars_get_long_name(c->v, vs->src));
+            ex->var = vs->src;
+            return 1;
+        }
+        return 0;
+    }
+
+    double val;
+    if( ex->type == et_tok && has_const_var(c, ex) && eval_num(c, ex, &val) &&
+        accept(c, ex, opt_cost_num_bytes(val) - opt_cost_expr_bytes(ex), opt_cost_expr_time(ex)) )
+        return replace_all_vars(c, ex);
+
+    return do_propagate(c, ex->lft) + do_propagate(c, ex->rgt);
+}
+
+// Propagates values to an expression and fold the result
+static int prop_read(prop_ctx *c, expr *ex)
+{
+    int x = do_propagate(c, ex);
+    if( x )
+        opt_constprop(ex);
+    return x;
+}
+
+// Stores the value assigned to a variable
+static void set_var(prop_ctx *c, unsigned id, const expr *val)
+{
+    double x;
+    vstate *vs = &c->st[id];
+
+    kill_var(c, id);
+    if( expr_is_cnum(val) )
+    {
+        vs->known = vk_const;
+        vs->type = val->type;
+        vs->num = val->num;
+    }
+    else if( eval_num(c, val, &x) )
+    {
+        vs->known = vk_const;
+        vs->type = et_c_number;
+        vs->num = x;
+    }
+    else if( val && val->type == et_var_number && val->var != id )
+    {
+        vs->known = vk_copy;
+        vs->src = val->var;
+    }
+}
+
+static int prop_assign(prop_ctx *c, expr *ex)
+{
+    expr *a = ex->rgt;
+    if( !a || a->type != et_tok || !a->lft || !a->rgt ||
+        (a->tok != TOK_F_ASGN && a->tok != TOK_S_ASGN) )
+    {
+        kill_vars(c, a);
+        return 0;
+    }
+    if( a->lft->type == et_var_number )
+    {
+        int x = prop_read(c, a->rgt);
+        set_var(c, a->lft->var, a->rgt);
+        return x;
+    }
+    if( a->lft->type == et_var_string )
+        return prop_read(c, a->rgt);
+    if( a->lft->type == et_tok && (a->lft->tok == TOK_A_L_PRN || a->lft->tok == TOK_S_L_PRN) )
+        return prop_read(c, a->lft->rgt) + prop_read(c, a->rgt);
+    kill_vars(c, a);
+    return 0;
+}
+
+// Propagates to the start, end and step of a FOR statement
+static int prop_for(prop_ctx *c, expr *ex)
+{
+    expr *var, *start, *end, *step;
+    if( !opt_for_parts(ex, &var, &start, &end, &step) )
+        return 0;
+    int x = do_propagate(c, start);
+    // The limit and step are evaluated after assigning the variable
+    kill_var(c, var->var);
+    x += do_propagate(c, end);
+    if( step )
+        x += do_propagate(c, step);
+    if( x )
+        opt_constprop(ex->rgt);
+    return x;
+}
+
+// Returns the statement closing a loop
+static enum enum_statements loop_close(enum enum_statements stmt)
+{
+    switch( stmt )
+    {
+        case STMT_FOR:    return STMT_NEXT;
+        case STMT_WHILE:  return STMT_WEND;
+        case STMT_REPEAT: return STMT_UNTIL;
+        case STMT_DO:     return STMT_LOOP;
+        default:          return stmt;
+    }
+}
+
+static int is_loop_var(expr *ex, const expr *var)
+{
+    if( !var )
+        return 1;
+    if( ex->stmt == STMT_FOR )
+    {
+        expr *v = opt_for_var(ex);
+        return v && v->var == var->var;
+    }
+    return ex->rgt && ex->rgt->type == et_var_number && ex->rgt->var == var->var;
+}
+
+// At the start of the loop, forgets the values of all variables written
+// inside the loop body. Returns 1 if the loop can be entered from other
+// places or if the loop end can't be determined.
+static int loop_body_writes(prop_ctx *c, expr *head)
+{
+    enum enum_statements close = loop_close(head->stmt);
+    const expr *var = head->stmt == STMT_FOR ? opt_for_var(head) : 0;
+    int depth = 0, ifdepth = 0;
+
+    if( head->stmt == STMT_FOR && !var )
+        return 1;
+
+    for(expr *ex = head->lft; ex; ex = ex->lft)
+    {
+        if( ex->type == et_lnum )
+        {
+            if( opt_is_target(c->targets, ex) )
+                return 1;
+            continue;
+        }
+        if( ex->type != et_stmt )
+            continue;
+
+        if( ex->stmt == head->stmt && is_loop_var(ex, var) )
+            depth ++;
+        else if( ex->stmt == close && is_loop_var(ex, var) )
+        {
+            if( !depth )
+                return ifdepth != 0;
+            depth --;
+        }
+
+        switch( stmt_class(ex->stmt) )
+        {
+            case fc_none:
+            case fc_read:
+            case fc_end:
+                break;
+            case fc_assign:
+                if( ex->rgt && ex->rgt->type == et_tok && ex->rgt->lft &&
+                    ex->rgt->lft->type == et_var_number )
+                    kill_var(c, ex->rgt->lft->var);
+                break;
+            case fc_write:
+                kill_vars(c, ex->rgt);
+                break;
+            case fc_branch:
+            case fc_jump:
+            case fc_call:
+            case fc_target:
+                return 1;
+            case fc_block:
+                if( ex->stmt == STMT_IF_THEN || ex->stmt == STMT_IF_MULTILINE )
+                    ifdepth ++;
+                else if( ex->stmt == STMT_ENDIF || ex->stmt == STMT_ENDIF_INVISIBLE )
+                    ifdepth --;
+                else if( ex->stmt == STMT_FOR )
+                {
+                    expr *v = opt_for_var(ex);
+                    if( !v )
+                        return 1;
+                    kill_var(c, v->var);
+                }
+                else if( ex->stmt == STMT_NEXT )
+                    kill_vars(c, ex->rgt);
+                break;
+        }
+    }
+    // End of loop not found
+    return 1;
+}
+
+static void loop_head(prop_ctx *c, expr *ex, unsigned var)
+{
+    if( loop_body_writes(c, ex) )
+        kill_all(c);
+    push_block(c, ex->stmt, var);
+}
+
+static int prop_block(prop_ctx *c, expr *ex)
+{
+    block *b;
+    int x = 0;
+
+    switch( ex->stmt )
+    {
+        case STMT_IF_THEN:
+        case STMT_IF_MULTILINE:
+            x = prop_read(c, ex->rgt);
+            push_block(c, ex->stmt, 0);
+            return x;
+        case STMT_ELSE:
+            b = top_block(c);
+            if( !b || b->has_else ||
+                (b->stmt != STMT_IF_THEN && b->stmt != STMT_IF_MULTILINE) )
+            {
+                reset_blocks(c);
+                return 0;
+            }
+            b->alt = copy_state(c);
+            b->has_else = 1;
+            memcpy(c->st, b->st, sizeof(vstate) * c->nv);
+            return 0;
+        case STMT_ENDIF:
+        case STMT_ENDIF_INVISIBLE:
+            b = top_block(c);
+            if( !b || (b->stmt != STMT_IF_THEN && b->stmt != STMT_IF_MULTILINE) )
+            {
+                reset_blocks(c);
+                return 0;
+            }
+            merge_state(c, b->has_else ? b->alt : b->st);
+            pop_block(c);
+            return 0;
+        case STMT_FOR:
+        {
+            expr *v = opt_for_var(ex);
+            x = prop_for(c, ex);
+            if( !v )
+            {
+                kill_vars(c, ex->rgt);
+                reset_blocks(c);
+                return x;
+            }
+            kill_var(c, v->var);
+            loop_head(c, ex, v->var);
+            return x;
+        }
+        case STMT_NEXT:
+            b = top_block(c);
+            if( !b || b->stmt != STMT_FOR || !ex->rgt ||
+                ex->rgt->type != et_var_number || ex->rgt->var != b->var )
+            {
+                reset_blocks(c);
+                return 0;
+            }
+            memcpy(c->st, b->st, sizeof(vstate) * c->nv);
+            pop_block(c);
+            return 0;
+        case STMT_WHILE:
+            loop_head(c, ex, 0);
+            return prop_read(c, ex->rgt);
+        case STMT_REPEAT:
+        case STMT_DO:
+            loop_head(c, ex, 0);
+            return 0;
+        case STMT_UNTIL:
+            x = prop_read(c, ex->rgt);
+            b = top_block(c);
+            if( !b || b->stmt != STMT_REPEAT )
+                reset_blocks(c);
+            else
+            {
+                memcpy(c->st, b->st, sizeof(vstate) * c->nv);
+                pop_block(c);
+            }
+            return x;
+        case STMT_WEND:
+        case STMT_LOOP:
+            b = top_block(c);
+            if( !b || b->stmt != (ex->stmt == STMT_WEND ? STMT_WHILE : STMT_DO) )
+                reset_blocks(c);
+            else
+            {
+                memcpy(c->st, b->st, sizeof(vstate) * c->nv);
+                pop_block(c);
+            }
+            return 0;
+        case STMT_EXIT:
+            // Continues after the loop end
+            kill_all(c);
+            return 0;
+        default:
+            reset_blocks(c);
+            return 0;
+    }
+}
+
+static int prop_stmt(prop_ctx *c, expr *ex)
+{
+    int x = 0;
+    assert(ex && ex->type == et_stmt);
+
+    switch( stmt_class(ex->stmt) )
+    {
+        case fc_none:
+            return 0;
+        case fc_read:
+        case fc_branch:
+            return prop_read(c, ex->rgt);
+        case fc_assign:
+            return prop_assign(c, ex);
+        case fc_write:
+            kill_vars(c, ex->rgt);
+            return 0;
+        case fc_jump:
+        case fc_end:
+            x = prop_read(c, ex->rgt);
+            kill_all(c);
+            return x;
+        case fc_call:
+        case fc_target:
+            kill_all(c);
+            return 0;
+        case fc_block:
+            return prop_block(c, ex);
+    }
+    return 0;
+}
+
+int opt_propagate(expr *prog, enum opt_objective obj)
+{
+    if( !prog )
+        return 0;
+
+    prop_ctx c;
+    c.v = pgm_get_vars( expr_get_program(prog) );
+    c.nv = vars_get_total(c.v);
+    c.st = dcalloc(c.nv + 1, sizeof(vstate));
+    c.targets = opt_targets_new();
+    c.obj = obj;
+    c.blocks = darray_new(block, 16);
+    opt_search_targets(c.targets, prog);
+
+    if( c.targets->all )
+        info_print(expr_get_file_name(prog), 0,
+                   "target line number not constant, values are not propagated across lines.\n");
+
+    int num = 0;
+    for(expr *ex = prog; ex != 0; ex = ex->lft )
+    {
+        if( ex->type == et_lnum )
+        {
+            if( opt_is_target(c.targets, ex) )
+                kill_all(&c);
+        }
+        else if( ex->type == et_stmt )
+            num += prop_stmt(&c, ex);
+    }
+
+    if( num )
+        info_print(expr_get_file_name(prog), 0, "propagated %d variable values.\n", num);
+
+    while( darray_len(c.blocks) )
+        pop_block(&c);
+    darray_free(c.blocks);
+    opt_targets_free(c.targets);
+    free(c.st);
+    return 0;
+}
@@ -23,6 +23,8 @@
 #include "dmem.h"
 #include "program.h"
 #include "darray.h"
+#include "optcost.h"
+#include "remarks.h"
 #include <assert.h>
 #include <stdlib.h>
 #include <string.h>
@@ -34,6 +36,7 @@ typedef struct {
     unsigned written;  // Times written (or label defined)
     unsigned read;     // Times read (used in expression)
     unsigned total;    // Total usage
+    unsigned weight;   // Usage weighted by the loop depth
     int replace;       // Will replace with constant value
     double rep_val;    // Value to replace
     int rep_line;      // Line number of assignment
@@ -66,8 +69,9 @@ static int tok_is_assignment(expr *ex)
            ex->tok == TOK_D_L_PRN || ex->tok == TOK_DS_L_PRN;
 }
 
-// Assign new IDs to variables, most used variables first
-static void var_list_assign_new_id(var_list *vl, vars *nvar, const char *fname)
+// Assign new IDs to variables, most used variables first. If "by_weight" is
+// set, always sort the variables using the weighted usage.
+static void var_list_assign_new_id(var_list *vl, vars *nvar, const char *fname, int by_weight)
 {
     int num = darray_len(vl);
     int *idx = dmalloc(sizeof(int) * num);
@@ -81,6 +85,9 @@ static void var_list_assign_new_id(var_list *vl, vars *nvar, const char *fname)
             idx[nused] = i;
             nused++;
         }
+        else
+            remark("remove_vars", fname, 0, remark_applied, OPT_COST_VAR_SLOT_BYTES, 0,
+                   "removed unused variable '%s'", darray_i(vl, i).name);
     }
     for(int i=nused; i<num; i++)
         idx[i] = -1;
@@ -89,14 +96,15 @@ static void var_list_assign_new_id(var_list *vl, vars *nvar, const char *fname)
         info_print(fname, 0, "removing %d unused variables.\n", num - nused);
 
     // Only sort variables if there is a gain in doing so, in this case, only
-    // if we have more than 127 variables.
-    if( nused > 127 )
+    // if we have more than 127 variables or if requested.
+    if( nused > 127 || by_weight )
     {
         for(int i=1; i<nused; i++)
         {
             int j = i, tmp = idx[j];
-            unsigned total = darray_i(vl, tmp).total;
-            for( ; j>0 && darray_i(vl, idx[j-1]).total < total; j--)
+            unsigned total = by_weight ? darray_i(vl, tmp).weight : darray_i(vl, tmp).total;
+            for( ; j>0 && (by_weight ? darray_i(vl, idx[j-1]).weight
+                                     : darray_i(vl, idx[j-1]).total) < total; j--)
                 idx[j] = idx[j-1];
             idx[j] = tmp;
         }
@@ -462,6 +470,59 @@ static int do_get_var_usage(expr *ex, var_list *vl)
     return err;
 }
 
+// Weight of a variable use inside "depth" nested loops
+static unsigned loop_weight(int depth)
+{
+    return 1U << (3 * (depth < 4 ? depth : 4));
+}
+
+static void add_var_weight(expr *ex, var_list *vl, unsigned weight)
+{
+    if( !ex )
+        return;
+    if( expr_is_var(ex) )
+    {
+        var_in_range(ex->var);
+        darray_i(vl, ex->var).weight += weight;
+    }
+    add_var_weight(ex->lft, vl, weight);
+    add_var_weight(ex->rgt, vl, weight);
+}
+
+// Counts variable usage, multiplying the uses inside loops, or by the
+// execution count of the statement if there is a profile.
+static void do_get_var_weight(expr *ex, var_list *vl)
+{
+    int depth = 0;
+    for( ; ex ; ex = ex->lft )
+    {
+        if( ex->type != et_stmt )
+            continue;
+        // The WHILE condition is evaluated on each iteration
+        if( ex->stmt == STMT_WHILE )
+            depth ++;
+        long count = opt_cost_exec_count(ex);
+        add_var_weight(ex->rgt, vl, count < 0 ? loop_weight(depth) : (unsigned)count);
+        switch( ex->stmt )
+        {
+            case STMT_FOR:
+            case STMT_REPEAT:
+            case STMT_DO:
+                depth ++;
+                break;
+            case STMT_NEXT:
+            case STMT_WEND:
+            case STMT_UNTIL:
+            case STMT_LOOP:
+                if( depth )
+                    depth --;
+                break;
+            default:
+                break;
+        }
+    }
+}
+
 // Replace variable assignment with a REM
 static int do_replace_var_assign(expr *ex, unsigned id, double val)
 {
@@ -538,7 +599,7 @@ static var_list *create_var_list(expr *prog)
         var_usage vu;
         vu.name = vars_get_long_name(v, i);
         vu.type = vars_get_type(v, i);
-        vu.read = vu.written = vu.total = 0;
+        vu.read = vu.written = vu.total = vu.weight = 0;
         vu.new_id = 0;
         vu.replace = 0;
         vu.rep_val = 0;
@@ -548,7 +609,7 @@ static var_list *create_var_list(expr *prog)
     return vl;
 }
 
-int opt_remove_unused_vars(expr *prog)
+static int remove_unused_vars(expr *prog, int by_weight)
 {
     if( !prog )
         return 0;
@@ -556,10 +617,12 @@ int opt_remove_unused_vars(expr *prog)
     var_list *vl = create_var_list(prog);
 
     do_get_var_usage(prog, vl);
+    if( by_weight )
+        do_get_var_weight(prog, vl);
 
     // Now, recreate variable list!
     vars *nvar = vars_new();
-    var_list_assign_new_id(vl, nvar, expr_get_file_name(prog));
+    var_list_assign_new_id(vl, nvar, expr_get_file_name(prog), by_weight);
 
     // Replace variable ids in expressions
     do_replace_var_id(prog, vl);
@@ -571,6 +634,16 @@ int opt_remove_unused_vars(expr *prog)
     return 0;
 }
 
+int opt_remove_unused_vars(expr *prog)
+{
+    return remove_unused_vars(prog, 0);
+}
+
+int opt_sort_vars(expr *prog)
+{
+    return remove_unused_vars(prog, 1);
+}
+
 int opt_replace_fixed_vars(expr *prog)
 {
     if( !prog )
@@ -605,6 +678,8 @@ int opt_replace_fixed_vars(expr *prog)
                 {
                     info_print(expr_get_file_name(prog), 0,
                                "variable '%s' never written.\n", var_name(vu));
+                    remark("remove_vars", expr_get_file_name(prog), 0, remark_missed, 0, 0,
+                           "variable '%s' never written, not numeric", var_name(vu));
                 }
                 else
                 {
@@ -625,7 +700,11 @@ int opt_replace_fixed_vars(expr *prog)
                 do_again = 1;
             }
             else if( vu->written && !vu->read )
+            {
                 info_print(expr_get_file_name(prog), 0, "variable '%s' never read.\n", var_name(vu));
+                remark("remove_vars", expr_get_file_name(prog), 0, remark_missed, 0, 0,
+                       "variable '%s' never read, assignments are kept", var_name(vu));
+            }
         }
 
         // Perform the replacement
@@ -645,6 +724,10 @@ int opt_replace_fixed_vars(expr *prog)
                     int num = do_replace_var(prog, id, vu->rep_val);
                     info_print(expr_get_file_name(prog), 0, "variable '%s' replaced at %d locations.\n",
                                var_name(vu), num);
+                    remark("remove_vars", expr_get_file_name(prog), vu->rep_line > 0 ? vu->rep_line : 0,
+                           remark_applied, -num * (OPT_COST_NUM_BYTES - opt_cost_var_bytes(id)), 0,
+                           "variable '%s' replaced with %.12g at %d locations",
+                           var_name(vu), vu->rep_val, num);
                     do_again |= (num != 0);
                     vu->replace = 0;
                 }
@@ -22,5 +22,9 @@ typedef struct expr_struct expr;
 // Remove unused variables in the program
 int opt_remove_unused_vars(expr *ex);
 
+// Remove unused variables and number the rest by usage, counting the uses
+// inside loops more, so the most used get the smaller numbers and names.
+int opt_sort_vars(expr *ex);
+
 // Replace variables that have fixed values
 int opt_replace_fixed_vars(expr *ex);
@@ -0,0 +1,427 @@
+/*
+ *  Basic Parser - TurboBasic XL compatible parsing and transformation tool.
+ *  Copyright (C) 2015 Daniel Serpell
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "optstrength.h"
+#include "expr.h"
+#include "dbg.h"
+#include "parser.h"
+#include "remarks.h"
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// The floating point routines compute the power using LOG and EXP, so
+// "X^2" is a lot slower and less accurate than "X*X". Multiplication and
+// division are also slower than addition, specially in Atari BASIC. This
+// pass replaces those operations with equivalent ones that are faster:
+//  - X^1, X^2 and X^3 to X, X*X and X*X*X, with X a variable,
+//  - X*2 and 2*X to X+X, with X a variable,
+//  - X/C to X*(1/C), if the reciprocal of C is exact in BCD,
+//  - INT(A/B) to A DIV B (TurboBasic XL), if A and B are integers, A >= 0
+//    and B > 0.
+// Multiplications by greater powers of two are not replaced, as the
+// additions needed are slower than the multiplication.
+
+typedef struct {
+    enum opt_objective obj;
+    const expr *stmt;   // Current statement
+    int count;          // Number of replacements
+} sr_ctx;
+
+static int expr_is_cnum(const expr *ex)
+{
+    return ex && (ex->type == et_c_number || ex->type == et_c_hexnumber);
+}
+
+// Bytes of the parenthesis needed to write the operator "tok" as the left
+// or right child of "parent".
+static int paren_bytes(const expr *parent, int right, enum enum_tokens tok)
+{
+    if( !parent || parent->type != et_tok )
+        return 0;
+    int prec = tok_prec_level(parent->tok);
+    if( !right )
+        return prec > tok_prec_level(tok) ? 2 : 0;
+    if( tok_need_parens(parent->tok) )
+        return 0;
+    return (prec >= tok_prec_level(tok) && prec > 0) ? 2 : 0;
+}
+
+// Returns true if the expression can't be negative
+static int expr_is_nonneg(const expr *ex)
+{
+    if( !ex )
+        return 0;
+    if( expr_is_cnum(ex) )
+        return ex->num >= 0;
+    if( ex->type != et_tok )
+        return 0;
+    switch( ex->tok )
+    {
+        case TOK_N_LEQ:
+        case TOK_N_NEQ:
+        case TOK_N_GEQ:
+        case TOK_N_LE:
+        case TOK_N_GE:
+        case TOK_N_EQ:
+        case TOK_S_LEQ:
+        case TOK_S_NEQ:
+        case TOK_S_GEQ:
+        case TOK_S_LE:
+        case TOK_S_GE:
+        case TOK_S_EQ:
+        case TOK_NOT:
+        case TOK_OR:
+        case TOK_AND:
+        case TOK_ANDPER:
+        case TOK_EXCLAM:
+        case TOK_EXOR:
+        case TOK_PEEK:
+        case TOK_DPEEK:
+        case TOK_ABS:
+        case TOK_SQR:
+        case TOK_ASC:
+        case TOK_LEN:
+        case TOK_ADR:
+        case TOK_FRE:
+        case TOK_RND:
+        case TOK_PADDLE:
+        case TOK_STICK:
+        case TOK_PTRIG:
+        case TOK_STRIG:
+        case TOK_PER_0:
+        case TOK_PER_1:
+        case TOK_PER_2:
+        case TOK_PER_3:
+            return 1;
+        case TOK_L_PRN:
+        case TOK_UPLUS:
+        case TOK_INT:
+        case TOK_TRUNC:
+            return expr_is_nonneg(ex->rgt);
+        case TOK_PLUS:
+        case TOK_STAR:
+        case TOK_SLASH:
+        case TOK_DIV:
+            return expr_is_nonneg(ex->lft) && expr_is_nonneg(ex->rgt);
+        default:
+            return 0;
+    }
+}
+
+// Returns true if the expression always has an integer value
+static int expr_is_integer(const expr *ex)
+{
+    if( !ex )
+        return 0;
+    if( ex->type == et_c_hexnumber )
+        return 1;
+    if( ex->type == et_c_number )
+        return ex->num == floor(ex->num);
+    if( ex->type != et_tok )
+        return 0;
+    switch( ex->tok )
+    {
+        case TOK_N_LEQ:
+        case TOK_N_NEQ:
+        case TOK_N_GEQ:
+        case TOK_N_LE:
+        case TOK_N_GE:
+        case TOK_N_EQ:
+        case TOK_S_LEQ:
+        case TOK_S_NEQ:
+        case TOK_S_GEQ:
+        case TOK_S_LE:
+        case TOK_S_GE:
+        case TOK_S_EQ:
+        case TOK_NOT:
+        case TOK_OR:
+        case TOK_AND:
+        case TOK_ANDPER:
+        case TOK_EXCLAM:
+        case TOK_EXOR:
+        case TOK_DIV:
+        case TOK_INT:
+        case TOK_TRUNC:
+        case TOK_SGN:
+        case TOK_PEEK:
+        case TOK_DPEEK:
+        case TOK_ASC:
+        case TOK_LEN:
+        case TOK_ADR:
+        case TOK_FRE:
+        case TOK_PADDLE:
+        case TOK_STICK:
+        case TOK_PTRIG:
+        case TOK_STRIG:
+        case TOK_PER_0:
+        case TOK_PER_1:
+        case TOK_PER_2:
+        case TOK_PER_3:
+            return 1;
+        case TOK_L_PRN:
+        case TOK_UPLUS:
+        case TOK_UMINUS:
+        case TOK_ABS:
+            return expr_is_integer(ex->rgt);
+        case TOK_PLUS:
+        case TOK_MINUS:
+        case TOK_STAR:
+            return expr_is_integer(ex->lft) && expr_is_integer(ex->rgt);
+        default:
+            return 0;
+    }
+}
+
+// Reads the decimal mantissa of "x" with at most "digits" significant
+// digits, without trailing zeros. Returns 0 if "x" needs more digits.
+static int dec_mantissa(double x, int digits, uint64_t *m)
+{
+    char buf[64];
+    snprintf(buf, sizeof(buf), "%.*e", digits - 1, x);
+    if( strtod(buf, 0) != x )
+        return 0;
+    *m = 0;
+    for(const char *p = buf; *p && *p != 'e'; p++)
+        if( *p >= '0' && *p <= '9' )
+            *m = *m * 10 + (*p - '0');
+    while( *m && !(*m % 10) )
+        *m /= 10;
+    return 1;
+}
+
+// Returns the reciprocal of "x" if it is exact with the digits available
+// in the BCD numbers, or 0 if not.
+static double exact_reciprocal(double x)
+{
+    char buf[64];
+    uint64_t mx, mr;
+    // BCD numbers have 10 digits, but only 9 are available if the exponent
+    // is odd, as each byte holds two digits.
+    snprintf(buf, sizeof(buf), "%.8e", 1.0 / x);
+    double r = strtod(buf, 0);
+    if( !dec_mantissa(x, 10, &mx) || !dec_mantissa(r, 9, &mr) )
+        return 0;
+    // The product of the mantissas must be a power of 10
+    uint64_t p = mx * mr;
+    while( p >= 10 && !(p % 10) )
+        p /= 10;
+    return p == 1 ? r : 0;
+}
+
+// Check if the replacement is good for the objective, emitting the remarks.
+static int accept(sr_ctx *c, const expr *ex, int bytes, int time, const char *desc)
+{
+    time = opt_cost_hot_time(c->stmt, time);
+    if( !opt_cost_accept(c->obj, bytes, time) )
+    {
+        remark("strength", expr_get_file_name(ex), expr_get_file_line(ex), remark_missed,
+               -bytes, time, "%s not profitable", desc);
+        return 0;
+    }
+    info_print(expr_get_file_name(ex), expr_get_file_line(ex), "replacing %s.\n", desc);
+    remark("strength", expr_get_file_name(ex), expr_get_file_line(ex), remark_applied,
+           -bytes, time, "replaced %s", desc);
+    c->count ++;
+    return 1;
+}
+
+static expr *new_var(expr *ex, unsigned var)
+{
+    expr *n = expr_new_var_num(ex->mngr, var);
+    n->file_line = ex->file_line;
+    return n;
+}
+
+// X^1, X^2 and X^3
+static void reduce_power(sr_ctx *c, expr *ex, const expr *parent, int right)
+{
+    expr *v = ex->lft;
+    if( !v || v->type != et_var_number || !expr_is_cnum(ex->rgt) )
+        return;
+    double n = ex->rgt->num;
+    int old = opt_cost_var_bytes(0) + 1 + opt_cost_num_bytes(n) +
+              paren_bytes(parent, right, TOK_CARET);
+    int t_pow = opt_cost_tok_time(TOK_CARET);
+    int t_mul = opt_cost_tok_time(TOK_STAR);
+    int t_mul_p = paren_bytes(parent, right, TOK_STAR);
+
+    if( n == 1 )
+    {
+        if( accept(c, ex, opt_cost_var_bytes(0) - old, t_pow, "X^1 with X") )
+        {
+            unsigned var = v->var;
+            expr_delete(ex->rgt);
+            ex->lft = 0;
+            ex->rgt = 0;
+            ex->type = et_var_number;
+            ex->var = var;
+        }
+    }
+    else if( n == 2 )
+    {
+        if( accept(c, ex, 2 * opt_cost_var_bytes(0) + 1 + t_mul_p - old, t_pow - t_mul,
+                   "X^2 with X*X") )
+        {
+            ex->tok = TOK_STAR;
+            ex->rgt = new_var(ex, v->var);
+        }
+    }
+    else if( n == 3 )
+    {
+        if( accept(c, ex, 3 * opt_cost_var_bytes(0) + 2 + t_mul_p - old, t_pow - 2 * t_mul,
+                   "X^3 with X*X*X") )
+        {
+            expr *l = expr_new_bin(ex->mngr, v, new_var(ex, v->var), TOK_STAR);
+            l->file_line = ex->file_line;
+            ex->tok = TOK_STAR;
+            ex->lft = l;
+            ex->rgt = new_var(ex, v->var);
+        }
+    }
+}
+
+// X*2 and 2*X
+static void reduce_double(sr_ctx *c, expr *ex, const expr *parent, int right)
+{
+    expr *v, *k;
+    if( ex->lft && ex->lft->type == et_var_number && expr_is_cnum(ex->rgt) )
+    {
+        v = ex->lft;
+        k = ex->rgt;
+    }
+    else if( ex->rgt && ex->rgt->type == et_var_number && expr_is_cnum(ex->lft) )
+    {
+        v = ex->rgt;
+        k = ex->lft;
+    }
+    else
+        return;
+    if( k->num != 2 )
+        return;
+
+    int bytes = opt_cost_var_bytes(0) - opt_cost_num_bytes(2) +
+                paren_bytes(parent, right, TOK_PLUS) - paren_bytes(parent, right, TOK_STAR);
+    int time = opt_cost_tok_time(TOK_STAR) - opt_cost_tok_time(TOK_PLUS);
+    if( accept(c, ex, bytes, time, "X*2 with X+X") )
+    {
+        ex->tok = TOK_PLUS;
+        k->type = et_var_number;
+        k->var = v->var;
+        k->num = 0;
+    }
+}
+
+// X/C
+static void reduce_div(sr_ctx *c, expr *ex)
+{
+    expr *k = ex->rgt;
+    if( !expr_is_cnum(k) || k->num == 0 || k->num == 1 || k->num == -1 )
+        return;
+    double r = exact_reciprocal(k->num);
+    if( r == 0 )
+        return;
+
+    int bytes = opt_cost_num_bytes(r) - opt_cost_num_bytes(k->num);
+    int time = opt_cost_tok_time(TOK_SLASH) - opt_cost_tok_time(TOK_STAR);
+    if( accept(c, ex, bytes, time, "division by a constant with a multiplication") )
+    {
+        ex->tok = TOK_STAR;
+        k->type = et_c_number;
+        k->num = r;
+    }
+}
+
+// INT(A/B)
+static void reduce_int_div(sr_ctx *c, expr *ex, const expr *parent, int right)
+{
+    expr *d = ex->rgt;
+    if( parser_get_dialect() != parser_dialect_turbo ||
+        !d || d->type != et_tok || d->tok != TOK_SLASH )
+        return;
+    // INT rounds down and DIV truncates, so only equal if A/B >= 0. Also,
+    // the operand must not be an error. DIV works on integers, so both
+    // operands must be integers to give the same result.
+    if( !expr_is_cnum(d->rgt) || d->rgt->num <= 0 || d->rgt->num != floor(d->rgt->num) ||
+        !expr_is_nonneg(d->lft) || !expr_is_integer(d->lft) )
+        return;
+
+    // Removes the token, the parenthesis and the division
+    int bytes = paren_bytes(parent, right, TOK_DIV) - 3;
+    int time = opt_cost_tok_time(TOK_INT) + opt_cost_tok_time(TOK_SLASH) -
+               opt_cost_tok_time(TOK_DIV);
+    if( accept(c, ex, bytes, time, "INT(A/B) with A DIV B") )
+    {
+        ex->tok = TOK_DIV;
+        ex->lft = d->lft;
+        ex->rgt = d->rgt;
+    }
+}
+
+static void do_reduce(sr_ctx *c, expr *ex, const expr *parent, int right)
+{
+    if( !ex )
+        return;
+
+    // Replace INT(A/B) before the division is replaced
+    if( ex->type == et_tok && ex->tok == TOK_INT )
+        reduce_int_div(c, ex, parent, right);
+
+    do_reduce(c, ex->lft, ex, 0);
+    do_reduce(c, ex->rgt, ex, 1);
+
+    if( ex->type != et_tok )
+        return;
+
+    switch( ex->tok )
+    {
+        case TOK_CARET:
+            reduce_power(c, ex, parent, right);
+            break;
+        case TOK_STAR:
+            reduce_double(c, ex, parent, right);
+            break;
+        case TOK_SLASH:
+            reduce_div(c, ex);
+            break;
+        default:
+            break;
+    }
+}
+
+int opt_strength_reduce(expr *prog, enum opt_objective obj)
+{
+    sr_ctx c;
+    c.obj = obj;
+    c.stmt = 0;
+    c.count = 0;
+
+    for(expr *ex = prog; ex; ex = ex->lft)
+    {
+        if( ex->type != et_stmt )
+            continue;
+        c.stmt = ex;
+        do_reduce(&c, ex->rgt, ex, 1);
+    }
+
+    if( c.count )
+        info_print(expr_get_file_name(prog), 0, "replaced %d slow operations.\n", c.count);
+    return 0;
+}
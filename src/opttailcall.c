@@ -0,0 +1,235 @@
+/*
+ *  Basic Parser - TurboBasic XL compatible parsing and transformation tool.
+ *  Copyright (C) 2015 Daniel Serpell
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "opttailcall.h"
+#include "expr.h"
+#include "dbg.h"
+#include "darray.h"
+#include "optcost.h"
+#include "remarks.h"
+#include <assert.h>
+#include <stdlib.h>
+
+// Replaces "GOSUB n : RETURN" with "GOTO n", and "EXEC P : ENDPROC" with a
+// GOTO to the first line of the PROC. The subroutine returns directly to
+// the caller, saving the runtime stack entry.
+//
+// This is not valid if the stack can be inspected in other ways:
+//  - POP removes the top entry of the stack, that is not the same after the
+//    replacement,
+//  - after an error handled by TRAP, the program can continue with a
+//    different stack,
+//  - a loop open at the call can be closed from the subroutine, as NEXT
+//    is only valid if there is no GOSUB entry on top.
+
+typedef darray(int) tc_loop_list;
+
+typedef struct {
+    expr *prog;
+    tc_loop_list *loops;    // Nesting of IF at each open loop
+    int if_depth;           // Current nesting of IF
+    int count;              // Number of calls replaced
+} tc_ctx;
+
+static int expr_is_cnum(const expr *ex)
+{
+    return ex && (ex->type == et_c_number || ex->type == et_c_hexnumber);
+}
+
+static int check_hidden(const expr *ex)
+{
+    return ex && ex->type == et_stmt && ex->stmt == STMT_REM_HIDDEN;
+}
+
+// Returns a description of the statements that make the pass invalid
+static const char *search_invalid(expr *prog)
+{
+    for(expr *ex = prog; ex; ex = ex->lft)
+    {
+        if( ex->type != et_stmt )
+            continue;
+        if( ex->stmt == STMT_POP )
+            return "POP";
+        // TRAP with a line number not valid disables the TRAP
+        if( ex->stmt == STMT_TRAP && !(expr_is_cnum(ex->rgt) && ex->rgt->num >= 32767.5) )
+            return "TRAP";
+    }
+    return 0;
+}
+
+// Returns the statement executed after the call, skipping statements that
+// do nothing. Sets "next" if it follows the call directly, in the same line.
+static expr *next_exec(expr *ex, int *next)
+{
+    *next = 1;
+    for(ex = ex->lft; ex; ex = ex->lft)
+    {
+        if( ex->type == et_lnum )
+            *next = 0;
+        else if( ex->type == et_stmt &&
+                 (ex->stmt == STMT_ENDIF_INVISIBLE || ex->stmt == STMT_ENDIF) )
+            *next = 0;
+        else if( ex->type == et_stmt && ex->stmt != STMT_REM_HIDDEN )
+            break;
+    }
+    return ex;
+}
+
+// Returns the line number of the first line of the PROC, or -1 if not found
+// or the PROC is not at the end of a numbered line.
+static double proc_line(tc_ctx *c, const expr *label)
+{
+    for(expr *ex = c->prog; ex; ex = ex->lft)
+    {
+        if( ex->type != et_stmt || ex->stmt != STMT_PROC || !ex->rgt ||
+            ex->rgt->type != et_var_label || ex->rgt->var != label->var )
+            continue;
+        expr *n = ex->lft;
+        while( check_hidden(n) )
+            n = n->lft;
+        if( n && n->type == et_lnum && n->num >= 0 )
+            return n->num;
+        return -1;
+    }
+    return -1;
+}
+
+// Tracks the open loops, a loop is closed only in the same nesting of IF.
+static void track_loops(tc_ctx *c, const expr *ex)
+{
+    switch( ex->stmt )
+    {
+        case STMT_IF_THEN:
+        case STMT_IF_MULTILINE:
+            c->if_depth ++;
+            break;
+        case STMT_ENDIF:
+        case STMT_ENDIF_INVISIBLE:
+            if( c->if_depth )
+                c->if_depth --;
+            break;
+        case STMT_FOR:
+        case STMT_WHILE:
+        case STMT_REPEAT:
+        case STMT_DO:
+            darray_add(c->loops, c->if_depth);
+            break;
+        case STMT_NEXT:
+        case STMT_WEND:
+        case STMT_UNTIL:
+        case STMT_LOOP:
+            if( darray_len(c->loops) &&
+                darray_i(c->loops, darray_len(c->loops) - 1) == c->if_depth )
+                darray_len(c->loops) --;
+            break;
+        default:
+            break;
+    }
+}
+
+static void do_tail_call(tc_ctx *c, expr *ex)
+{
+    int next;
+    expr *n = next_exec(ex, &next);
+    const char *name;
+    double target = 0;
+
+    if( ex->stmt == STMT_GOSUB && n && n->stmt == STMT_RETURN )
+        name = "GOSUB";
+    else if( ex->stmt == STMT_EXEC && n && n->stmt == STMT_ENDPROC )
+    {
+        name = "EXEC";
+        target = proc_line(c, ex->rgt);
+        if( target < 0 )
+        {
+            remark("tail_calls", expr_get_file_name(ex), expr_get_file_line(ex), remark_missed,
+                   0, 0, "EXEC before ENDPROC: PROC is not followed by a numbered line");
+            return;
+        }
+    }
+    else
+        return;
+
+    if( darray_len(c->loops) )
+    {
+        remark("tail_calls", expr_get_file_name(ex), expr_get_file_line(ex), remark_missed,
+               0, 0, "%s before %s: inside a loop", name, statements[n->stmt].stm_long);
+        return;
+    }
+
+    int bytes = 0;
+    if( ex->stmt == STMT_EXEC )
+    {
+        // The label is replaced by the line number
+        ex->rgt = expr_new_number(ex->mngr, target);
+        ex->rgt->file_line = ex->file_line;
+        bytes = opt_cost_var_bytes(0) - opt_cost_num_bytes(target);
+    }
+    ex->stmt = STMT_GOTO;
+    // The RETURN is not reachable if it follows the call, but the ENDPROC
+    // is needed to skip the PROC body.
+    if( next && n->stmt == STMT_RETURN )
+    {
+        ex->lft = n->lft;
+        bytes += OPT_COST_STMT_BYTES;
+    }
+    info_print(expr_get_file_name(ex), expr_get_file_line(ex),
+               "replacing %s before %s with GOTO.\n", name, statements[n->stmt].stm_long);
+    remark("tail_calls", expr_get_file_name(ex), expr_get_file_line(ex), remark_applied,
+           bytes, opt_cost_stmt_time(n->stmt), "replaced %s before %s with GOTO",
+           name, statements[n->stmt].stm_long);
+    c->count ++;
+}
+
+int opt_tail_calls(expr *prog)
+{
+    if( !prog )
+        return 0;
+
+    const char *inv = search_invalid(prog);
+    if( inv )
+    {
+        info_print(expr_get_file_name(prog), 0,
+                   "program uses %s, can't replace tail calls.\n", inv);
+        remark("tail_calls", expr_get_file_name(prog), 0, remark_missed, 0, 0,
+               "program uses %s, tail calls are not replaced", inv);
+        return 0;
+    }
+
+    tc_ctx c;
+    c.prog = prog;
+    c.loops = darray_new(int, 16);
+    c.if_depth = 0;
+    c.count = 0;
+
+    for(expr *ex = prog; ex; ex = ex->lft)
+    {
+        if( ex->type != et_stmt )
+            continue;
+        if( ex->stmt == STMT_GOSUB || ex->stmt == STMT_EXEC )
+            do_tail_call(&c, ex);
+        else
+            track_loops(&c, ex);
+    }
+
+    if( c.count )
+        info_print(expr_get_file_name(prog), 0, "replaced %d tail calls.\n", c.count);
+
+    darray_free(c.loops);
+    return 0;
+}
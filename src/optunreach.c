@@ -0,0 +1,534 @@
+/*
+ *  Basic Parser - TurboBasic XL compatible parsing and transformation tool.
+ *  Copyright (C) 2015 Daniel Serpell
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "optunreach.h"
+#include "expr.h"
+#include "vars.h"
+#include "dbg.h"
+#include "dmem.h"
+#include "darray.h"
+#include "program.h"
+#include "optlinenum.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// How a statement affects the reachability of the next statement
+enum reach_class {
+    rc_normal,  // Continues at the next statement
+    rc_jump,    // Never continues at the next statement
+    rc_keep,    // Must be kept, even if unreachable
+    rc_entry,   // Can be reached from other statement, must be kept
+    rc_proc,    // Start of a procedure
+    rc_endproc  // End of a procedure
+};
+
+static enum reach_class stmt_class(enum enum_statements stmt)
+{
+    switch(stmt)
+    {
+        case STMT_BAS_ERROR:
+        case STMT_BGET:
+        case STMT_BLOAD:
+        case STMT_BPUT:
+        case STMT_BRUN:
+        case STMT_CIRCLE:
+        case STMT_CLOAD:
+        case STMT_CLOSE:
+        case STMT_CLR:
+        case STMT_CLS:
+        case STMT_COLOR:
+        case STMT_COM:
+        case STMT_CONT:
+        case STMT_CSAVE:
+        case STMT_DEG:
+        case STMT_DEL:
+        case STMT_DELETE:
+        case STMT_DIM:
+        case STMT_DIR:
+        case STMT_DPOKE:
+        case STMT_DRAWTO:
+        case STMT_DSOUND:
+        case STMT_DUMP:
+        case STMT_ENTER:
+        case STMT_EXEC:
+        case STMT_EXEC_PAR:
+        case STMT_F_B:
+        case STMT_FCOLOR:
+        case STMT_F_F:
+        case STMT_FILLTO:
+        case STMT_F_L:
+        case STMT_GET:
+        case STMT_GOSUB:
+        case STMT_GRAPHICS:
+        case STMT_IF:
+        case STMT_IF_NUMBER:
+        case STMT_INPUT:
+        case STMT_LET:
+        case STMT_LET_INV:
+        case STMT_LIST:
+        case STMT_LOAD:
+        case STMT_LOCATE:
+        case STMT_LOCK:
+        case STMT_LPRINT:
+        case STMT_MOVE:
+        case STMT_N_MOVE:
+        case STMT_NOTE:
+        case STMT_ON:
+        case STMT_OPEN:
+        case STMT_PAINT:
+        case STMT_PAUSE:
+        case STMT_P_GET:
+        case STMT_PLOT:
+        case STMT_POINT:
+        case STMT_POKE:
+        case STMT_POP:
+        case STMT_POSITION:
+        case STMT_P_PUT:
+        case STMT_PRINT:
+        case STMT_PRINT_:
+        case STMT_PUT:
+        case STMT_RAD:
+        case STMT_READ:
+        case STMT_RENAME:
+        case STMT_RENUM:
+        case STMT_RESTORE:
+        case STMT_SAVE:
+        case STMT_SETCOLOR:
+        case STMT_SOUND:
+        case STMT_STATUS:
+        case STMT_TEXT:
+        case STMT_TIME_S:
+        case STMT_TRACE:
+        case STMT_TRAP:
+        case STMT_UNLOCK:
+        case STMT_XIO:
+            return rc_normal;
+
+        case STMT_BYE:
+        case STMT_DOS:
+        case STMT_END:
+        case STMT_EXIT:
+        case STMT_GO_S:
+        case STMT_GOTO:
+        case STMT_GO_TO:
+        case STMT_NEW:
+        case STMT_RETURN:
+        case STMT_RUN:
+        case STMT_STOP:
+            return rc_jump;
+
+        // DATA is used by READ, and comments are never executed. The start
+        // of blocks are kept to preserve the block structure.
+        case STMT_DATA:
+        case STMT_REM:
+        case STMT_REM_:
+        case STMT_REM_HIDDEN:
+        case STMT_DO:
+        case STMT_FOR:
+        case STMT_IF_MULTILINE:
+        case STMT_IF_THEN:
+        case STMT_REPEAT:
+        case STMT_WHILE:
+            return rc_keep;
+
+        // Those are reached from the start of the block or from a loop exit.
+        case STMT_ELSE:
+        case STMT_ENDIF:
+        case STMT_ENDIF_INVISIBLE:
+        case STMT_LBL_S:
+        case STMT_LOOP:
+        case STMT_NEXT:
+        case STMT_UNTIL:
+        case STMT_WEND:
+            return rc_entry;
+
+        case STMT_PROC:
+        case STMT_PROC_VAR:
+            return rc_proc;
+
+        case STMT_ENDPROC:
+            return rc_endproc;
+    }
+    return rc_keep;
+}
+
+static void bitmap_set(uint8_t *bmp, int n)
+{
+    bmp[n>>3] |= (1 << (n&7));
+}
+
+static int bitmap_get(const uint8_t *bmp, int n)
+{
+    return 0 != (bmp[n>>3] & (1 << (n&7)));
+}
+
+static int expr_is_cnum(const expr *ex)
+{
+    return ex && (ex->type == et_c_number || ex->type == et_c_hexnumber);
+}
+
+// One removed procedure or subroutine, for the report
+typedef struct {
+    const char *name;   // PROC name, or NULL for subroutines
+    int line;           // BASIC line number of subroutines
+    int gosub;          // The line is called by GOSUB from removed code
+    int file_line;      // Line in the source file
+    int count;          // Number of statements removed
+} removed_sub;
+
+typedef darray(removed_sub) removed_list;
+
+typedef struct {
+    lnum_targets *targets;  // Line numbers referenced from reachable code
+    uint8_t *gosubs;    // Line numbers called by GOSUB, used in the report
+    uint8_t *labels;    // Labels referenced from reachable code
+    unsigned nvars;     // Number of variables, size of "labels"
+    int procs;          // Procedures and labels are only reached if called
+    vars *v;
+    removed_list *report;
+} reach_ctx;
+
+// Marks a label as used, returns 1 if this is a new label
+static int add_label(reach_ctx *c, const expr *ex)
+{
+    if( !ex || ex->type != et_var_label || ex->var >= c->nvars )
+        return 0;
+    if( bitmap_get(c->labels, ex->var) )
+        return 0;
+    bitmap_set(c->labels, ex->var);
+    return 1;
+}
+
+// Adds all targets in a list of line numbers or labels
+static int add_list(reach_ctx *c, const expr *ex, int label)
+{
+    int num = 0;
+    while( ex && ex->type == et_tok && ex->tok == TOK_COMMA )
+    {
+        num += label ? add_label(c, ex->rgt) : opt_add_target(c->targets, ex->rgt);
+        ex = ex->lft;
+    }
+    return num + (label ? add_label(c, ex) : opt_add_target(c->targets, ex));
+}
+
+// Adds all the line numbers and labels referenced in the statement,
+// returns the number of new references.
+static int add_references(reach_ctx *c, expr *ex)
+{
+    switch( ex->stmt )
+    {
+        case STMT_TRAP:
+        case STMT_RESTORE:
+            if( ex->rgt && ex->rgt->type == et_tok && ex->rgt->tok == TOK_SHARP )
+                return add_label(c, ex->rgt->rgt);
+            // RESTORE targets are only used for DATA, that is never removed.
+            if( ex->stmt == STMT_RESTORE )
+                return 0;
+            break;
+        case STMT_EXEC:
+        case STMT_GO_S:
+            return add_label(c, ex->rgt);
+        case STMT_EXEC_PAR:
+            if( ex->rgt && ex->rgt->type == et_tok && ex->rgt->tok == TOK_COMMA )
+                return add_label(c, ex->rgt->lft);
+            return 0;
+        case STMT_ON:
+            if( ex->rgt && ex->rgt->type == et_tok &&
+                (ex->rgt->tok == TOK_ON_EXEC || ex->rgt->tok == TOK_ON_GOSHARP) )
+                return add_list(c, ex->rgt->rgt, 1);
+            break;
+        default:
+            break;
+    }
+    // Line numbers, IF without THEN makes all lines reachable
+    expr *t = opt_stmt_targets(ex);
+    return t ? add_list(c, t, 0) : 0;
+}
+
+// Marks a constant line number called by GOSUB
+static void add_gosub(reach_ctx *c, const expr *t)
+{
+    if( expr_is_cnum(t) && t->num >= 0 && t->num < 32767.5 )
+        bitmap_set(c->gosubs, (int)(t->num + 0.5));
+}
+
+// Search all lines called by GOSUB
+static void search_gosubs(reach_ctx *c, expr *prog)
+{
+    for(expr *ex = prog; ex != 0; ex = ex->lft )
+    {
+        if( ex->type != et_stmt || (ex->stmt != STMT_GOSUB && !(ex->stmt == STMT_ON &&
+            ex->rgt && ex->rgt->type == et_tok && ex->rgt->tok == TOK_ON_GOSUB)) )
+            continue;
+        expr *t = opt_stmt_targets(ex);
+        for( ; t && t->type == et_tok && t->tok == TOK_COMMA; t = t->lft)
+            add_gosub(c, t->rgt);
+        add_gosub(c, t);
+    }
+}
+
+// Returns the label of a PROC or label statement
+static const expr *stmt_label(const expr *ex)
+{
+    const expr *l = ex->rgt;
+    if( ex->stmt == STMT_PROC_VAR && l && l->type == et_tok && l->tok == TOK_COMMA )
+        l = l->lft;
+    if( l && l->type == et_var_label )
+        return l;
+    return 0;
+}
+
+static int label_used(const reach_ctx *c, const expr *ex)
+{
+    const expr *l;
+    if( !c->procs )
+        return 1;
+    l = stmt_label(ex);
+    return !l || l->var >= c->nvars || bitmap_get(c->labels, l->var);
+}
+
+// Returns the ENDPROC that ends the PROC, this is the last ENDPROC before the
+// next PROC or the end of the program, as the PROC can also return from the
+// middle with a conditional ENDPROC. Returns NULL if there is no ENDPROC.
+static const expr *proc_end(const expr *ex)
+{
+    const expr *end = 0;
+    for(ex = ex->lft; ex; ex = ex->lft)
+    {
+        if( ex->type != et_stmt )
+            continue;
+        if( ex->stmt == STMT_ENDPROC )
+            end = ex;
+        else if( ex->stmt == STMT_PROC || ex->stmt == STMT_PROC_VAR )
+            break;
+    }
+    return end;
+}
+
+// Returns true if the PROC is called or if any statement inside the PROC
+// can be reached from other parts of the program.
+static int proc_used(const reach_ctx *c, expr *ex)
+{
+    const expr *end = proc_end(ex);
+    if( !end || label_used(c, ex) )
+        return 1;
+    for(ex = ex->lft; ex != end; ex = ex->lft)
+    {
+        if( ex->type == et_lnum && opt_is_target(c->targets, ex) )
+            return 1;
+        if( ex->type == et_stmt && ex->stmt == STMT_LBL_S && label_used(c, ex) )
+            return 1;
+    }
+    return 0;
+}
+
+// Replace statement with a comment
+static void remove_stmt(expr *ex)
+{
+    char buf[256];
+    enum enum_statements stmt = ex->stmt == STMT_LET_INV ? STMT_LET :
+                                ex->stmt == STMT_ENDIF_INVISIBLE ? STMT_ENDIF : ex->stmt;
+    const char *name = statements[stmt].stm_long;
+    int len = sprintf(buf, "unreachable %s", name);
+    info_print(expr_get_file_name(ex), expr_get_file_line(ex),
+               "removing unreachable '%s' statement.\n", name);
+    ex->stmt = STMT_REM_HIDDEN;
+    ex->rgt = expr_new_data(ex->mngr, (const uint8_t *)buf, len, 0);
+}
+
+// Adds a new item to the removed procedures and subroutines report
+static void report_add(reach_ctx *c, const expr *ex, const char *name, int line)
+{
+    removed_sub r;
+    r.name = name;
+    r.line = line;
+    r.gosub = !name && bitmap_get(c->gosubs, line);
+    r.file_line = expr_get_file_line(ex);
+    r.count = 0;
+    darray_add(c->report, r);
+}
+
+// Traverses the program following the flow. If "remove" is false, adds the
+// targets referenced from all reachable statements and returns the number of
+// new targets. If "remove" is true, removes all unreachable statements and
+// returns the number of statements removed.
+static int do_sweep(reach_ctx *c, expr *prog, int remove)
+{
+    int reach = 1;      // Current statement is reachable
+    int proc_reach = 1; // Statement after ENDPROC is reachable
+    int dead_proc = 0;  // Inside a PROC that is never called
+    const expr *end_proc = 0; // ENDPROC of the current PROC
+    int in_report = 0;  // Counting statements for the last report item
+    int new_block = 1;  // Last statement never continues to the next line
+    int num = 0;
+
+    for(expr *ex = prog; ex != 0; ex = ex->lft )
+    {
+        if( ex->type == et_lnum )
+        {
+            if( opt_is_target(c->targets, ex) )
+                reach = 1;
+            // Report all the removed blocks starting at a line number, a
+            // new block starts after a PROC, after a jump or at a line called
+            // by GOSUB.
+            if( remove && !dead_proc && !reach && ex->num >= 0 && ex->num < 32767.5 &&
+                (!in_report || new_block || darray_i(c->report, darray_len(c->report) - 1).name ||
+                 bitmap_get(c->gosubs, (int)(ex->num + 0.5))) )
+            {
+                report_add(c, ex, 0, (int)(ex->num + 0.5));
+                in_report = 1;
+            }
+            continue;
+        }
+        if( ex->type != et_stmt )
+            continue;
+
+        int del = 0;
+        enum reach_class rc = stmt_class(ex->stmt);
+        new_block = rc == rc_jump || rc == rc_endproc;
+        switch( rc )
+        {
+            case rc_normal:
+                del = !reach;
+                break;
+            case rc_jump:
+                del = !reach;
+                if( reach && !remove )
+                    num += add_references(c, ex);
+                reach = 0;
+                break;
+            case rc_keep:
+                // Inside a removed PROC, only keep DATA and comments
+                del = dead_proc && !reach && ex->stmt != STMT_DATA &&
+                      ex->stmt != STMT_REM && ex->stmt != STMT_REM_ &&
+                      ex->stmt != STMT_REM_HIDDEN;
+                break;
+            case rc_entry:
+                if( ex->stmt == STMT_LBL_S )
+                {
+                    if( label_used(c, ex) )
+                        reach = 1;
+                    del = !reach;
+                }
+                else if( dead_proc )
+                    del = !reach;
+                else
+                    reach = 1;
+                break;
+            case rc_proc:
+                // When reached by the program flow, PROC skips to the ENDPROC.
+                proc_reach = reach;
+                end_proc = proc_end(ex);
+                dead_proc = !proc_used(c, ex);
+                reach = !dead_proc;
+                del = dead_proc;
+                if( remove && dead_proc )
+                {
+                    const expr *l = stmt_label(ex);
+                    report_add(c, ex, l ? vars_get_long_name(c->v, l->var) : "?", 0);
+                    in_report = 1;
+                }
+                break;
+            case rc_endproc:
+                del = dead_proc;
+                // ENDPROC in the middle of the PROC returns from the call
+                if( end_proc && ex != end_proc )
+                {
+                    del = del || !reach;
+                    reach = 0;
+                    break;
+                }
+                reach = proc_reach;
+                end_proc = 0;
+                proc_reach = 1;
+                dead_proc = 0;
+                break;
+        }
+
+        if( remove && del )
+        {
+            remove_stmt(ex);
+            if( in_report )
+                darray_i(c->report, darray_len(c->report) - 1).count ++;
+            num ++;
+        }
+        else if( !remove && reach && rc == rc_normal )
+            num += add_references(c, ex);
+
+        // Stop counting for the report after reaching an entry point
+        if( reach )
+            in_report = 0;
+    }
+    return num;
+}
+
+int opt_remove_unreachable(expr *prog, int procs)
+{
+    if( !prog )
+        return 0;
+
+    reach_ctx c;
+    c.v = pgm_get_vars( expr_get_program(prog) );
+    c.nvars = vars_get_total(c.v);
+    c.targets = opt_targets_new();
+    c.gosubs = dcalloc(32768/8, 1);
+    c.labels = dcalloc(c.nvars/8 + 1, 1);
+    c.procs = procs;
+    c.report = darray_new(removed_sub, 8);
+
+    // Starting from the program start, add the targets of all reachable
+    // statements until there are no more.
+    while( do_sweep(&c, prog, 0) )
+        ;
+
+    if( c.targets->all )
+        info_print(expr_get_file_name(prog), 0,
+                   "target line number not constant, assuming all lines are reachable.\n");
+
+    search_gosubs(&c, prog);
+
+    int total = do_sweep(&c, prog, 1);
+    if( total )
+        info_print(expr_get_file_name(prog), 0, "removed %d unreachable statements.\n", total);
+
+    // Report removed procedures and subroutines
+    if( do_debug && darray_len(c.report) )
+    {
+        removed_sub *r;
+        fprintf(stderr, "Removed procedures and subroutines:\n");
+        darray_foreach(r, c.report)
+        {
+            if( !r->count )
+                continue;
+            if( r->name )
+                fprintf(stderr, " PROC %s, at %s(%d): %d statements\n",
+                        r->name, expr_get_file_name(prog), r->file_line, r->count);
+            else
+                fprintf(stderr, " %s %d, at %s(%d): %d statements\n", r->gosub ? "GOSUB" : "line",
+                        r->line, expr_get_file_name(prog), r->file_line, r->count);
+        }
+    }
+
+    darray_free(c.report);
+    free(c.labels);
+    free(c.gosubs);
+    opt_targets_free(c.targets);
+    return 0;
+}
@@ -0,0 +1,348 @@
+/*
+ *  Basic Parser - TurboBasic XL compatible parsing and transformation tool.
+ *  Copyright (C) 2015 Daniel Serpell
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "optunroll.h"
+#include "expr.h"
+#include "basexpr.h"
+#include "dbg.h"
+#include "optconst.h"
+#include "remarks.h"
+#include "optutil.h"
+#include <math.h>
+
+// Replaces FOR loops with a small constant number of iterations with one
+// copy of the loop body for each iteration, replacing the loop variable
+// with its value, and an assignment of the final value of the variable:
+//
+//   FOR I=0 TO 2:POKE A+I,0:NEXT I
+//     -> POKE A,0:POKE A+1,0:POKE A+2,0:I=3
+//
+// This saves the NEXT on each iteration, but makes the program bigger, so
+// it is mostly done with the speed objective or in hot loops from the
+// profile. The copies are joined to the line of the FOR, so the loop can't
+// contain IF/THEN or other statements that depend on the end of the line,
+// jumps or calls that could read the loop variable.
+
+// Maximum number of iterations of the unrolled loops
+#define UNROLL_MAX_COUNT 8
+// Maximum bytes that the program can grow on each unrolled loop
+#define UNROLL_MAX_BYTES 128
+
+typedef struct {
+    enum opt_objective obj;
+    int count;          // Number of loops unrolled
+} ur_ctx;
+
+static int expr_is_cnum(const expr *ex)
+{
+    return ex && (ex->type == et_c_number || ex->type == et_c_hexnumber);
+}
+
+static int uses_var(const expr *ex, unsigned var)
+{
+    if( !ex )
+        return 0;
+    if( ex->type == et_var_number && ex->var == var )
+        return 1;
+    return uses_var(ex->lft, var) || uses_var(ex->rgt, var);
+}
+
+// Statements inside the loop that are not copied
+static int not_copied(const expr *ex)
+{
+    return ex->stmt == STMT_REM || ex->stmt == STMT_REM_ || ex->stmt == STMT_REM_HIDDEN;
+}
+
+static int stmt_bytes(const expr *ex)
+{
+    // Statement length and statement tokens
+    return 1 + expr_get_bas_len(ex);
+}
+
+// Searches the NEXT of the loop and checks if the statements can be
+// copied, returns the reason if not.
+static const char *check_body(expr *loop, unsigned var, expr **next, int *bytes)
+{
+    int loops = 0, ifs = 0;
+    *bytes = 0;
+    for(expr *ex = loop->lft; ex; ex = ex->lft)
+    {
+        if( ex->type == et_lnum )
+        {
+            if( ex->num >= 0 )
+                return "loop spans more than one numbered line";
+            continue;
+        }
+        if( ex->type != et_stmt )
+            continue;
+        switch( ex->stmt )
+        {
+            case STMT_NEXT:
+                if( !loops )
+                {
+                    if( !ex->rgt || ex->rgt->type != et_var_number || ex->rgt->var != var )
+                        return "NEXT of other variable";
+                    if( ifs )
+                        return "NEXT inside IF";
+                    *next = ex;
+                    return 0;
+                }
+                if( uses_var(ex->rgt, var) )
+                    return "NEXT inside other loop";
+                loops --;
+                break;
+            case STMT_FOR:
+            {
+                const expr *v = opt_for_var(ex);
+                if( !v || v->var == var )
+                    return "loop variable modified in the loop";
+                loops ++;
+                break;
+            }
+            case STMT_WHILE:
+            case STMT_REPEAT:
+            case STMT_DO:
+                loops ++;
+                break;
+            case STMT_WEND:
+            case STMT_UNTIL:
+            case STMT_LOOP:
+            case STMT_EXIT:
+                if( !loops )
+                    return "loop closed or exited from inside";
+                if( ex->stmt != STMT_EXIT )
+                    loops --;
+                break;
+            case STMT_IF_MULTILINE:
+                ifs ++;
+                break;
+            case STMT_ELSE:
+            case STMT_ENDIF:
+                if( !ifs )
+                    return "IF closed from inside the loop";
+                if( ex->stmt == STMT_ENDIF )
+                    ifs --;
+                break;
+            case STMT_IF:
+            case STMT_IF_THEN:
+            case STMT_IF_NUMBER:
+                return "loop contains IF/THEN";
+            case STMT_DATA:
+                return "loop contains DATA";
+            case STMT_GOTO:
+            case STMT_GO_TO:
+            case STMT_GO_S:
+            case STMT_GOSUB:
+            case STMT_ON:
+            case STMT_EXEC:
+            case STMT_EXEC_PAR:
+            case STMT_RETURN:
+            case STMT_POP:
+            case STMT_LBL_S:
+            case STMT_PROC:
+            case STMT_PROC_VAR:
+            case STMT_ENDPROC:
+            case STMT_ENTER:
+                return "loop contains jumps or calls";
+            case STMT_LET:
+            case STMT_LET_INV:
+                if( ex->rgt && ex->rgt->type == et_tok && ex->rgt->tok == TOK_F_ASGN &&
+                    ex->rgt->lft && ex->rgt->lft->type == et_var_number &&
+                    ex->rgt->lft->var == var )
+                    return "loop variable modified in the loop";
+                break;
+            case STMT_GET:
+            case STMT_LOCATE:
+            case STMT_INPUT:
+            case STMT_P_GET:
+            case STMT_READ:
+            case STMT_NOTE:
+            case STMT_STATUS:
+                if( uses_var(ex->rgt, var) )
+                    return "loop variable modified in the loop";
+                break;
+            default:
+                break;
+        }
+        if( !not_copied(ex) )
+            *bytes += stmt_bytes(ex);
+    }
+    return "NEXT not found";
+}
+
+// Replaces the variable "var" with the constant "val"
+static void subst_var(expr *ex, unsigned var, double val)
+{
+    if( !ex )
+        return;
+    if( ex->type == et_var_number && ex->var == var )
+    {
+        ex->type = et_c_number;
+        ex->num = val;
+        ex->var = 0;
+        return;
+    }
+    subst_var(ex->lft, var, val);
+    subst_var(ex->rgt, var, val);
+}
+
+// Removes additions of 0 and products by 1 left after the replacement,
+// as "A+I" with I=0.
+static expr *simplify(expr *ex)
+{
+    if( !ex )
+        return 0;
+    ex->lft = simplify(ex->lft);
+    ex->rgt = simplify(ex->rgt);
+    if( ex->type != et_tok || !ex->lft || !ex->rgt )
+        return ex;
+    if( (ex->tok == TOK_PLUS || ex->tok == TOK_MINUS) && expr_is_cnum(ex->rgt) && ex->rgt->num == 0 )
+        return ex->lft;
+    if( ex->tok == TOK_PLUS && expr_is_cnum(ex->lft) && ex->lft->num == 0 )
+        return ex->rgt;
+    if( (ex->tok == TOK_STAR || ex->tok == TOK_SLASH) && expr_is_cnum(ex->rgt) && ex->rgt->num == 1 )
+        return ex->lft;
+    if( ex->tok == TOK_STAR && expr_is_cnum(ex->lft) && ex->lft->num == 1 )
+        return ex->rgt;
+    return ex;
+}
+
+static int do_unroll(ur_ctx *c, expr *loop, const expr *line)
+{
+    const expr *var = opt_for_var(loop);
+    double start, end, step;
+    if( !var || !opt_for_bounds(loop, &start, &end, &step) )
+        return 0;
+    if( step == 0 || start != floor(start) || end != floor(end) || step != floor(step) )
+        return 0;
+
+    // The body is executed at least once
+    double n = floor((end - start) / step) + 1;
+    if( n < 1 )
+        n = 1;
+    if( n > UNROLL_MAX_COUNT )
+        return 0;
+
+    const char *fname = expr_get_file_name(loop);
+    int fline = expr_get_file_line(loop);
+
+    expr *next = 0;
+    int body;
+    const char *err = check_body(loop, var->var, &next, &body);
+    if( err )
+    {
+        remark("unroll", fname, fline, remark_missed, 0, 0, "loop not unrolled: %s", err);
+        return 0;
+    }
+
+    // Build the copies of the body, then the final assignment
+    expr_mngr *m = loop->mngr;
+    expr *first = 0, *last = 0;
+    int bytes = 0;
+    for(int i = 0; i < n; i++)
+    {
+        double val = start + i * step;
+        for(const expr *ex = loop->lft; ex != next; ex = ex->lft)
+        {
+            if( ex->type != et_stmt || not_copied(ex) )
+                continue;
+            expr *s = expr_new_stmt(m, last, expr_copy(m, ex->rgt), ex->stmt);
+            s->file_line = ex->file_line;
+            if( s->rgt )
+            {
+                subst_var(s->rgt, var->var, val);
+                opt_constprop(s->rgt);
+                s->rgt = simplify(s->rgt);
+            }
+            bytes += stmt_bytes(s);
+            if( !first )
+                first = s;
+            last = s;
+        }
+    }
+    // The variable holds the first value past the end
+    expr *v = expr_new_var_num(m, var->var);
+    v->file_line = loop->file_line;
+    expr *k = expr_new_number(m, start + n * step);
+    k->file_line = loop->file_line;
+    last = expr_new_stmt(m, last, expr_new_bin(m, v, k, TOK_F_ASGN), STMT_LET_INV);
+    last->file_line = loop->file_line;
+    last->rgt->file_line = loop->file_line;
+    bytes += stmt_bytes(last);
+    if( !first )
+        first = last;
+    bytes -= stmt_bytes(loop) + body + stmt_bytes(next);
+
+    // Saves the FOR and the NEXT of each iteration
+    int time = opt_cost_hot_time(loop, opt_cost_stmt_time(STMT_FOR) - opt_cost_stmt_time(STMT_LET) +
+                                       (int)n * opt_cost_stmt_time(STMT_NEXT));
+    if( bytes > UNROLL_MAX_BYTES )
+    {
+        remark("unroll", fname, fline, remark_missed, -bytes, time,
+               "loop not unrolled: too big");
+        return 0;
+    }
+    if( !opt_cost_accept(c->obj, bytes, time) )
+    {
+        remark("unroll", fname, fline, remark_missed, -bytes, time,
+               "loop not unrolled: not profitable");
+        return 0;
+    }
+    if( !opt_line_fits(line, bytes > 0 ? bytes : 0, 255) )
+    {
+        remark("unroll", fname, fline, remark_missed, -bytes, time,
+               "loop not unrolled: line too long");
+        return 0;
+    }
+
+    info_print(fname, fline, "unrolling loop of %.0f iterations.\n", n);
+    remark("unroll", fname, fline, remark_applied, -bytes, time,
+           "unrolled loop of %.0f iterations", n);
+
+    // Replace the FOR with the first statement, and skip the loop
+    last->lft = next->lft;
+    loop->stmt = first->stmt;
+    loop->rgt = first->rgt;
+    loop->lft = first->lft;
+    c->count ++;
+    return 1;
+}
+
+int opt_unroll_loops(expr *prog, enum opt_objective obj)
+{
+    ur_ctx c;
+    c.obj = obj;
+    c.count = 0;
+
+    const expr *line = 0;
+    for(expr *ex = prog; ex; ex = ex->lft)
+    {
+        if( ex->type == et_lnum && ex->num >= 0 )
+            line = ex;
+        else
+        {
+            // The first statement of the copies could be another loop
+            while( ex->type == et_stmt && ex->stmt == STMT_FOR && do_unroll(&c, ex, line) )
+                ;
+        }
+    }
+
+    if( c.count )
+        info_print(expr_get_file_name(prog), 0, "unrolled %d loops.\n", c.count);
+    return 0;
+}
@@ -0,0 +1,268 @@
+/*
+ *  Basic Parser - TurboBasic XL compatible parsing and transformation tool.
+ *  Copyright (C) 2015 Daniel Serpell
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "optutil.h"
+#include "basexpr.h"
+#include "expr.h"
+#include <string.h>
+
+enum opt_stmt_kind opt_stmt_kind(enum enum_statements stmt)
+{
+    switch(stmt)
+    {
+        case STMT_DATA:
+        case STMT_REM:
+        case STMT_REM_:
+        case STMT_REM_HIDDEN:
+            return opt_sk_none;
+
+        case STMT_IF_MULTILINE:
+        case STMT_IF_NUMBER:
+        case STMT_IF_THEN:
+        case STMT_POP:
+            return opt_sk_read;
+
+        case STMT_BGET:
+        case STMT_BLOAD:
+        case STMT_BPUT:
+        case STMT_CIRCLE:
+        case STMT_CLOSE:
+        case STMT_CLS:
+        case STMT_COLOR:
+        case STMT_COM:
+        case STMT_CSAVE:
+        case STMT_DEG:
+        case STMT_DELETE:
+        case STMT_DIM:
+        case STMT_DIR:
+        case STMT_DPOKE:
+        case STMT_DRAWTO:
+        case STMT_DSOUND:
+        case STMT_DUMP:
+        case STMT_F_B:
+        case STMT_FCOLOR:
+        case STMT_F_F:
+        case STMT_FILLTO:
+        case STMT_F_L:
+        case STMT_GRAPHICS:
+        case STMT_LIST:
+        case STMT_LOCK:
+        case STMT_LPRINT:
+        case STMT_MOVE:
+        case STMT_N_MOVE:
+        case STMT_OPEN:
+        case STMT_PAINT:
+        case STMT_PAUSE:
+        case STMT_PLOT:
+        case STMT_POINT:
+        case STMT_POKE:
+        case STMT_POSITION:
+        case STMT_PRINT:
+        case STMT_PRINT_:
+        case STMT_PUT:
+        case STMT_P_PUT:
+        case STMT_RAD:
+        case STMT_RENAME:
+        case STMT_RESTORE:
+        case STMT_SAVE:
+        case STMT_SETCOLOR:
+        case STMT_SOUND:
+        case STMT_TEXT:
+        case STMT_TIME_S:
+        case STMT_TRACE:
+        case STMT_TRAP:
+        case STMT_UNLOCK:
+        case STMT_XIO:
+            return opt_sk_clobber;
+
+        case STMT_LET:
+        case STMT_LET_INV:
+            return opt_sk_assign;
+
+        case STMT_GET:
+        case STMT_INPUT:
+        case STMT_LOCATE:
+        case STMT_NOTE:
+        case STMT_P_GET:
+        case STMT_READ:
+        case STMT_STATUS:
+            return opt_sk_write;
+
+        case STMT_BYE:
+        case STMT_CLOAD:
+        case STMT_CONT:
+        case STMT_DOS:
+        case STMT_END:
+        case STMT_ENDPROC:
+        case STMT_GO_S:
+        case STMT_GOTO:
+        case STMT_GO_TO:
+        case STMT_LOAD:
+        case STMT_NEW:
+        case STMT_RETURN:
+        case STMT_RUN:
+        case STMT_STOP:
+            return opt_sk_last;
+
+        case STMT_DO:
+        case STMT_ELSE:
+        case STMT_ENDIF:
+        case STMT_ENDIF_INVISIBLE:
+        case STMT_EXIT:
+        case STMT_FOR:
+        case STMT_LOOP:
+        case STMT_NEXT:
+        case STMT_REPEAT:
+        case STMT_UNTIL:
+        case STMT_WEND:
+        case STMT_WHILE:
+            return opt_sk_block;
+
+        case STMT_BAS_ERROR:
+        case STMT_BRUN:
+        case STMT_CLR:
+        case STMT_DEL:
+        case STMT_ENTER:
+        case STMT_EXEC:
+        case STMT_EXEC_PAR:
+        case STMT_GOSUB:
+        case STMT_IF:
+        case STMT_LBL_S:
+        case STMT_ON:
+        case STMT_PROC:
+        case STMT_PROC_VAR:
+        case STMT_RENUM:
+            return opt_sk_call;
+    }
+    return opt_sk_call;
+}
+
+static int expr_is_cnum(const expr *ex)
+{
+    return ex && (ex->type == et_c_number || ex->type == et_c_hexnumber);
+}
+
+int opt_volatile_addr(double a)
+{
+    return (a >= 18 && a <= 20) ||      // RTCLOK, real time clock
+           a == 77 ||                   // ATRACT, attract mode timer
+           (a >= 536 && a <= 545) ||    // CDTMV1 to CDTMV5, system timers
+           (a >= 624 && a <= 647) ||    // Paddles, joysticks and triggers
+           a == 764 ||                  // CH, last key pressed
+           (a >= 53248 && a < 55296);   // Hardware registers
+}
+
+expr *opt_strip_prn(expr *ex)
+{
+    while( ex && ex->type == et_tok && ex->tok == TOK_L_PRN && !ex->lft && ex->rgt )
+        ex = ex->rgt;
+    return ex;
+}
+
+int opt_expr_equal(expr *a, expr *b)
+{
+    a = opt_strip_prn(a);
+    b = opt_strip_prn(b);
+    if( !a || !b )
+        return a == b;
+    if( expr_is_cnum(a) && expr_is_cnum(b) )
+        return a->num == b->num;
+    if( a->type != b->type )
+        return 0;
+    if( a->type == et_var_number || a->type == et_var_string )
+        return a->var == b->var;
+    if( a->type == et_c_string )
+        return a->slen == b->slen && !memcmp(a->str, b->str, a->slen);
+    if( a->type != et_tok || a->tok != b->tok )
+        return 0;
+    return opt_expr_equal(a->lft, b->lft) && opt_expr_equal(a->rgt, b->rgt);
+}
+
+int opt_has_usr(const expr *ex)
+{
+    if( !ex )
+        return 0;
+    if( ex->type == et_tok && ex->tok == TOK_USR )
+        return 1;
+    return opt_has_usr(ex->lft) || opt_has_usr(ex->rgt);
+}
+
+int opt_for_parts(expr *ex, expr **var, expr **start, expr **end, expr **step)
+{
+    expr *f = ex->rgt, *s = 0, *e = 0;
+    if( f && f->type == et_tok && f->tok == TOK_STEP )
+    {
+        s = f->rgt;
+        f = f->lft;
+    }
+    if( !f || f->type != et_tok || f->tok != TOK_FOR_TO )
+        return 0;
+    e = f->rgt;
+    f = f->lft;
+    if( !f || f->type != et_tok || f->tok != TOK_F_ASGN ||
+        !f->lft || f->lft->type != et_var_number )
+        return 0;
+    if( var )
+        *var = f->lft;
+    if( start )
+        *start = f->rgt;
+    if( end )
+        *end = e;
+    if( step )
+        *step = s;
+    return 1;
+}
+
+expr *opt_for_var(expr *ex)
+{
+    expr *var;
+    return opt_for_parts(ex, &var, 0, 0, 0) ? var : 0;
+}
+
+int opt_for_bounds(expr *ex, double *start, double *end, double *step)
+{
+    expr *s, *e, *st;
+    if( !opt_for_parts(ex, 0, &s, &e, &st) || !expr_is_cnum(s) || !expr_is_cnum(e) ||
+        (st && !expr_is_cnum(st)) )
+        return 0;
+    *start = s->num;
+    *end = e->num;
+    *step = st ? st->num : 1;
+    return 1;
+}
+
+int opt_line_fits(const expr *line, unsigned add, unsigned maxlen)
+{
+    // Lines without number can be split at any place
+    if( !line || line->type != et_lnum || line->num < 0 )
+        return 1;
+
+    // Line number (2), line length and EOL
+    unsigned len = 3 + add;
+    for(const expr *ex = line->lft; ex && ex->type != et_lnum; ex = ex->lft)
+    {
+        if( ex->type != et_stmt )
+            continue;
+        // Statement length and statement tokens
+        len += 1 + expr_get_bas_len(ex);
+        unsigned m = expr_get_bas_maxlen(ex);
+        if( m < maxlen )
+            maxlen = m;
+    }
+    return len <= maxlen;
+}
@@ -0,0 +1,68 @@
+/*
+ *  Basic Parser - TurboBasic XL compatible parsing and transformation tool.
+ *  Copyright (C) 2015 Daniel Serpell
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+#pragma once
+
+#include "statements.h"
+
+typedef struct expr_struct expr;
+
+// Helpers shared by the optimization passes that analyze expressions.
+
+// How a statement is handled by the passes that track expressions
+enum opt_stmt_kind {
+    opt_sk_none,    // Does not read or write anything
+    opt_sk_read,    // Reads expressions, does not write memory
+    opt_sk_clobber, // Reads expressions, can write to memory
+    opt_sk_assign,  // Assignment
+    opt_sk_write,   // Writes to all variables in the statement
+    opt_sk_last,    // Reads expressions, continues elsewhere
+    opt_sk_block,   // Structured statements
+    opt_sk_call     // Calls, labels or other statements that change the flow
+};
+
+// Returns how the statement reads and writes variables and memory
+enum opt_stmt_kind opt_stmt_kind(enum enum_statements stmt);
+
+// Returns true if the memory location is changed by the OS or the hardware
+int opt_volatile_addr(double a);
+
+// Skips parenthesis around an expression
+expr *opt_strip_prn(expr *ex);
+
+// Compares two expressions, ignoring parenthesis
+int opt_expr_equal(expr *a, expr *b);
+
+// Returns true if the expression calls machine code
+int opt_has_usr(const expr *ex);
+
+// Splits a FOR statement in the variable, the start, the limit and the step,
+// any output can be NULL. The step is NULL if not given. Returns 0 if the
+// statement is not valid.
+int opt_for_parts(expr *ex, expr **var, expr **start, expr **end, expr **step);
+
+// Returns the variable of a FOR statement, or NULL if invalid.
+expr *opt_for_var(expr *ex);
+
+// Reads the start, end and step of the FOR, returns 0 if not constant.
+int opt_for_bounds(expr *ex, double *start, double *end, double *step);
+
+// Returns true if "add" bytes can be added to the line starting at "line"
+// without splitting it, with at most "maxlen" bytes in the line. The
+// maximum length also depends on the statements in the line, see
+// expr_get_bas_maxlen.
+int opt_line_fits(const expr *line, unsigned add, unsigned maxlen);
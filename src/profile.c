@@ -0,0 +1,284 @@
+/*
+ *  Basic Parser - TurboBasic XL compatible parsing and transformation tool.
+ *  Copyright (C) 2015 Daniel Serpell
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "profile.h"
+#include "program.h"
+#include "expr.h"
+#include "darray.h"
+#include "dbg.h"
+#include "dmem.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+typedef darray(unsigned long) count_list;
+typedef darray(uint32_t) hash_list;
+
+struct profile_struct {
+    count_list *counts; // Execution count of each source line
+};
+
+// One entry read from the profile file
+typedef struct {
+    int line;           // Source line or BASIC line number
+    int basic;          // Line is a BASIC line number
+    int has_hash;       // The hash was given
+    uint32_t hash;      // Hash of the source line
+    unsigned long count;
+} profile_entry;
+
+typedef darray(profile_entry) profile_entry_list;
+
+// FNV-1a hash of the line, ignoring blanks at the start and the end
+uint32_t profile_line_hash(const char *line, unsigned len)
+{
+    while( len && (*line == ' ' || *line == '\t') )
+    {
+        line++;
+        len--;
+    }
+    while( len && (line[len-1] == ' ' || line[len-1] == '\t' || line[len-1] == '\r') )
+        len--;
+    uint32_t h = 2166136261U;
+    for(unsigned i=0; i<len; i++)
+    {
+        h ^= (uint8_t)line[i];
+        h *= 16777619U;
+    }
+    return h;
+}
+
+// Reads the full file to memory, returns the length or -1 on error
+static long read_file(const char *fname, char **data)
+{
+    FILE *f = fopen(fname, "rb");
+    if( !f )
+        return -1;
+    long len = -1;
+    if( 0 == fseek(f, 0, SEEK_END) )
+        len = ftell(f);
+    if( len < 0 || fseek(f, 0, SEEK_SET) )
+    {
+        fclose(f);
+        return -1;
+    }
+    *data = dmalloc(len + 1);
+    len = fread(*data, 1, len, f);
+    fclose(f);
+    return len;
+}
+
+// Hash all the lines of the source file, the first line is at index 1
+static hash_list *hash_source(const char *fname)
+{
+    char *data;
+    long len = read_file(fname, &data);
+    if( len < 0 )
+        return 0;
+    hash_list *hl = darray_new(uint32_t, 256);
+    darray_add(hl, 0);
+    long start = 0;
+    for(long i=0; i<=len; i++)
+    {
+        if( i == len || data[i] == '\n' )
+        {
+            if( i == len && start == len )
+                break;
+            darray_add(hl, profile_line_hash(data + start, i - start));
+            start = i + 1;
+        }
+    }
+    free(data);
+    return hl;
+}
+
+// Parses one line of the profile file, returns 1 if an entry was read,
+// 0 if the line is empty and -1 on error.
+static int parse_entry(const char *buf, profile_entry *e)
+{
+    const char *p = buf;
+    char *end;
+    while( *p == ' ' || *p == '\t' )
+        p++;
+    if( !*p || *p == '\n' || *p == '\r' || *p == '#' )
+        return 0;
+
+    memset(e, 0, sizeof(*e));
+    if( *p == 'L' || *p == 'l' )
+    {
+        e->basic = 1;
+        p++;
+    }
+    long l = strtol(p, &end, 10);
+    if( end == p || l < 0 || (e->basic && l > 32767) || (!e->basic && l < 1) )
+        return -1;
+    e->line = l;
+    p = end;
+    e->count = strtoul(p, &end, 10);
+    if( end == p )
+        return -1;
+    p = end;
+    unsigned long h = strtoul(p, &end, 16);
+    if( end != p )
+    {
+        if( e->basic )
+            return -1;
+        e->has_hash = 1;
+        e->hash = h;
+        p = end;
+    }
+    while( *p == ' ' || *p == '\t' || *p == '\r' || *p == '\n' )
+        p++;
+    return *p ? -1 : 1;
+}
+
+// Returns the source line with the given hash nearest to "line", or 0
+static int find_hash(const hash_list *hl, uint32_t hash, int line)
+{
+    int best = 0;
+    for(int i=1; i<(int)darray_len(hl); i++)
+        if( darray_i(hl, i) == hash && (!best || abs(i - line) < abs(best - line)) )
+            best = i;
+    return best;
+}
+
+static void add_count(profile *p, int line, unsigned long count)
+{
+    while( darray_len(p->counts) <= (unsigned)line )
+        darray_add(p->counts, 0);
+    darray_i(p->counts, line) += count;
+}
+
+profile *profile_load(const char *fname, program *pgm)
+{
+    const char *src = pgm_get_file_name(pgm);
+    FILE *f = fopen(fname, "r");
+    if( !f )
+    {
+        err_print(fname, 0, "can't open profile: %s\n", strerror(errno));
+        return 0;
+    }
+
+    // Read all the entries
+    profile_entry_list *pl = darray_new(profile_entry, 256);
+    char buf[256];
+    int fline = 0, err = 0, need_hash = 0;
+    while( fgets(buf, sizeof(buf), f) )
+    {
+        profile_entry e;
+        fline ++;
+        int r = parse_entry(buf, &e);
+        if( r < 0 )
+        {
+            err_print(fname, fline, "invalid profile entry.\n");
+            err = 1;
+        }
+        else if( r > 0 )
+        {
+            darray_add(pl, e);
+            need_hash |= e.has_hash;
+        }
+    }
+    fclose(f);
+    if( err )
+    {
+        darray_free(pl);
+        return 0;
+    }
+
+    profile *p = dmalloc(sizeof(profile));
+    p->counts = darray_new(unsigned long, 256);
+
+    // Source line entries, moved to the line with the same content if the
+    // source changed after the profile was taken.
+    hash_list *hl = need_hash ? hash_source(src) : 0;
+    if( need_hash && !hl )
+        warn_print(src, 0, "can't read source to match profile: %s\n", strerror(errno));
+    int stale = 0, moved = 0;
+    unsigned long *basic = 0;
+    profile_entry *e;
+    darray_foreach(e, pl)
+    {
+        if( e->basic )
+        {
+            if( !basic )
+                basic = dcalloc(32768, sizeof(unsigned long));
+            basic[e->line] += e->count;
+            continue;
+        }
+        int line = e->line;
+        if( e->has_hash && hl )
+        {
+            if( line >= (int)darray_len(hl) || darray_i(hl, line) != e->hash )
+            {
+                line = find_hash(hl, e->hash, line);
+                if( !line )
+                {
+                    stale ++;
+                    continue;
+                }
+                moved ++;
+            }
+        }
+        add_count(p, line, e->count);
+    }
+    if( moved )
+        info_print(fname, 0, "%d profile entries matched to moved source lines.\n", moved);
+    if( stale )
+        warn_print(fname, 0, "%d profile entries don't match the source, ignored.\n", stale);
+
+    // BASIC line numbers, applied to all the source lines up to the next
+    // numbered line.
+    if( basic )
+    {
+        unsigned long count = 0;
+        int last = -1;
+        for(expr *ex = pgm_get_expr(pgm); ex; ex = ex->lft)
+        {
+            if( ex->type == et_lnum && ex->num >= 0 && ex->num < 32768 )
+                count = basic[(int)ex->num];
+            if( count && ex->file_line != last )
+            {
+                add_count(p, ex->file_line, count);
+                last = ex->file_line;
+            }
+        }
+        free(basic);
+    }
+
+    if( hl )
+        darray_free(hl);
+    darray_free(pl);
+    return p;
+}
+
+void profile_delete(profile *p)
+{
+    if( !p )
+        return;
+    darray_free(p->counts);
+    free(p);
+}
+
+unsigned long profile_get_count(const profile *p, int file_line)
+{
+    if( file_line < 0 || (unsigned)file_line >= darray_len(p->counts) )
+        return 0;
+    return darray_i(p->counts, file_line);
+}
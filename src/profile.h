@@ -0,0 +1,37 @@
+/*
+ *  Basic Parser - TurboBasic XL compatible parsing and transformation tool.
+ *  Copyright (C) 2015 Daniel Serpell
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+#pragma once
+
+#include <stdint.h>
+
+typedef struct program_struct program;
+typedef struct profile_struct profile;
+
+// Reads the execution counts from the profile file and matches those with
+// the source lines of the program, must be called before transforming the
+// program. Returns NULL on error.
+profile *profile_load(const char *fname, program *pgm);
+
+// Deletes the profile
+void profile_delete(profile *p);
+
+// Returns the number of times the source line was executed.
+unsigned long profile_get_count(const profile *p, int file_line);
+
+// Returns the hash of a source line, used to match stale profiles.
+uint32_t profile_line_hash(const char *line, unsigned len);
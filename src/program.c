@@ -19,6 +19,7 @@
 #include "expr.h"
 #include "vars.h"
 #include "defs.h"
+#include "profile.h"
 #include "dmem.h"
 
 #include <stdlib.h>
@@ -32,6 +33,7 @@ struct program_struct {
     expr_mngr *mngr; // Expression manager.
     expr *expr;      // Tree representation of the program
     char *file_name; // Input file name
+    profile *prof;   // Execution profile
 };
 
 program *program_new(const char *file_name)
@@ -42,6 +44,7 @@ program *program_new(const char *file_name)
     p->defines   = defs_new();
     p->file_name = strdup(file_name);
     p->expr = 0;
+    p->prof = 0;
     p->mngr = expr_mngr_new(p);
     return p;
 }
@@ -51,6 +54,7 @@ void program_delete(program *p)
     vars_delete( p->variables );
     defs_delete( p->defines );
     expr_mngr_delete( p->mngr );
+    profile_delete( p->prof );
     free( p->file_name );
     free( p );
 }
@@ -91,3 +95,14 @@ const char *pgm_get_file_name(program *p)
 {
     return p->file_name;
 }
+
+void pgm_set_profile(program *p, profile *prof)
+{
+    profile_delete(p->prof);
+    p->prof = prof;
+}
+
+const profile *pgm_get_profile(program *p)
+{
+    return p->prof;
+}
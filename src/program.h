@@ -22,6 +22,7 @@ typedef struct expr_struct expr;
 typedef struct expr_mngr_struct expr_mngr;
 typedef struct vars_struct vars;
 typedef struct defs_struct defs;
+typedef struct profile_struct profile;
 
 program *program_new(const char *fname);
 void program_delete(program *p);
@@ -33,3 +34,7 @@ defs *pgm_get_defs(program *p);
 expr *pgm_get_expr(program *p);
 expr_mngr *pgm_get_expr_mngr(program *p);
 const char *pgm_get_file_name(program *p);
+
+// Execution profile, NULL if not loaded. The program owns the profile.
+void pgm_set_profile(program *p, profile *prof);
+const profile *pgm_get_profile(program *p);
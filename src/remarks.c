@@ -0,0 +1,85 @@
+/*
+ *  Basic Parser - TurboBasic XL compatible parsing and transformation tool.
+ *  Copyright (C) 2015 Daniel Serpell
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "remarks.h"
+#include <stdarg.h>
+#include <stdio.h>
+
+static FILE *remarks_file = 0;
+
+int remarks_open(const char *fname)
+{
+    remarks_close();
+    remarks_file = fopen(fname, "w");
+    return remarks_file != 0;
+}
+
+void remarks_close(void)
+{
+    if( remarks_file )
+        fclose(remarks_file);
+    remarks_file = 0;
+}
+
+int remarks_enabled(void)
+{
+    return remarks_file != 0;
+}
+
+// Writes a JSON string, escaping the special characters
+static void put_json_str(FILE *f, const char *s)
+{
+    putc('"', f);
+    for( ; *s; s++)
+    {
+        unsigned char c = *s;
+        if( c == '"' || c == '\\' )
+        {
+            putc('\\', f);
+            putc(c, f);
+        }
+        else if( c < 0x20 || c >= 0x7F )
+            fprintf(f, "\\u%04x", c);
+        else
+            putc(c, f);
+    }
+    putc('"', f);
+}
+
+void remark(const char *pass, const char *file, int line, enum remark_action act,
+            int bytes, int time, const char *reason, ...)
+{
+    if( !remarks_file )
+        return;
+
+    char buf[256];
+    va_list ap;
+    va_start(ap, reason);
+    vsnprintf(buf, sizeof(buf), reason, ap);
+    va_end(ap);
+
+    FILE *f = remarks_file;
+    fputs("{\"pass\":", f);
+    put_json_str(f, pass);
+    fputs(",\"file\":", f);
+    put_json_str(f, file ? file : "");
+    fprintf(f, ",\"line\":%d,\"action\":\"%s\",\"bytes\":%d,\"time\":%d,\"reason\":",
+            line, act == remark_applied ? "applied" : "missed", bytes, time);
+    put_json_str(f, buf);
+    fputs("}\n", f);
+}
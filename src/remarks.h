@@ -0,0 +1,42 @@
+/*
+ *  Basic Parser - TurboBasic XL compatible parsing and transformation tool.
+ *  Copyright (C) 2015 Daniel Serpell
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+#pragma once
+
+// Optimization remarks, written as one JSON object per line to a file.
+
+enum remark_action {
+    remark_applied,  // The transformation was done
+    remark_missed    // The transformation was not possible or not profitable
+};
+
+// Opens the remarks file, returns 0 on error.
+int remarks_open(const char *fname);
+
+// Closes the remarks file.
+void remarks_close(void);
+
+// Returns true if the remarks are being written.
+int remarks_enabled(void);
+
+// Writes one remark of the optimization "pass" at the given source file
+// and line (0 if the remark applies to the full program). "bytes" and
+// "time" are the bytes and the estimated time saved by the transformation,
+// negative if the program gets bigger or slower. The reason is formatted
+// as printf.
+void remark(const char *pass, const char *file, int line, enum remark_action act,
+            int bytes, int time, const char *reason, ...);